@@ -6,20 +6,29 @@
  * 
  * Этот заголовочный файл включает все основные алгебраические структуры:
  * - Множества и отображения
- * - Отношения и отношения эквивалентности
+ * - Отношения, отношения эквивалентности и частичные порядки
  * - Операции с мощностью
  * - Группоиды, полугруппы, моноиды, группы
- * - Подгруппы, нормальные подгруппы, смежные классы
- * - Фактор-группы
+ * - Перестановки и группы перестановок
+ * - Подгруппы, нормальные подгруппы, смежные и двойные смежные классы
+ * - Классы сопряжённости, нормальные замыкания, коммутанты и ряды подгрупп
+ * - Решётка подгрупп и силовские подгруппы
+ * - Фактор-группы и гомоморфизмы
  * - Порядок элементов и показатель группы
  * - Циклические группы
  * - Функция Эйлера
+ * - Алгоритмы возведения в степень
  */
 
 // Этап 1: Основа
 #include "core/set.hpp"
 #include "core/mapping.hpp"
+#include "core/bit_matrix.hpp"
+#include "core/relation_graph.hpp"
+#include "core/disjoint_set.hpp"
+#include "core/equivalence_partition.hpp"
 #include "core/relation.hpp"
+#include "core/poset.hpp"
 #include "core/cardinality.hpp"
 
 // Этап 2: Множества с одной операцией
@@ -29,12 +38,22 @@
 #include "core/monoid.hpp"
 #include "core/group.hpp"
 #include "core/cayley_table.hpp"
+#include "core/fixed_base_power.hpp"
+#include "core/permutation.hpp"
+#include "core/stabilizer_chain.hpp"
 
 // Этап 3: Подгруппы
 #include "core/subgroup.hpp"
 #include "core/normal_subgroup.hpp"
 #include "core/coset.hpp"
+#include "core/double_coset.hpp"
 #include "core/center.hpp"
+#include "core/conjugacy_classes.hpp"
+#include "core/normal_closure.hpp"
+#include "core/commutator.hpp"
+#include "core/subgroup_lattice.hpp"
+#include "core/sylow.hpp"
+#include "core/homomorphism.hpp"
 #include "core/factor_group.hpp"
 
 // Этап 4: Порядок элементов
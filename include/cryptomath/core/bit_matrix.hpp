@@ -0,0 +1,384 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Многопоточное булево произведение
+ *
+ * При CRYPTOMATH_PARALLEL = 1 BitMatrix::multiply_parallel распределяет строки
+ * результата между потоками std::thread; программа тогда должна линковаться с
+ * библиотекой потоков (CMake-опция CRYPTOMATH_PARALLEL добавляет Threads::Threads).
+ * По умолчанию (0) <thread> не подключается и multiply_parallel выполняется
+ * в вызывающем потоке.
+ */
+#ifndef CRYPTOMATH_PARALLEL
+#define CRYPTOMATH_PARALLEL 0
+#endif
+
+#if CRYPTOMATH_PARALLEL
+#include <thread>
+#endif
+
+namespace cryptomath {
+
+/**
+ * @brief Плотная булева матрица с упакованными в 64-битные слова строками
+ *
+ * Используется как представление бинарных отношений на конечных множествах:
+ * бит (i, j) равен 1 тогда и только тогда, когда i-й элемент связан с j-м.
+ * Операции над строками выполняются пословно (64 пары за инструкцию); циклы по
+ * словам строки непрерывны в памяти и векторизуются компилятором (AVX2/AVX-512
+ * при соответствующих флагах -march).
+ */
+class BitMatrix {
+public:
+    using word_type = std::uint64_t;
+    static constexpr size_t word_bits = 64;
+
+    BitMatrix() = default;
+
+    /**
+     * @brief Построить нулевую матрицу rows × cols
+     */
+    BitMatrix(size_t rows, size_t cols)
+        : rows_(rows), cols_(cols), words_per_row_((cols + word_bits - 1) / word_bits),
+          words_(rows * words_per_row_, 0) {}
+
+    /**
+     * @brief Единичная матрица n × n (отношение равенства)
+     */
+    static BitMatrix identity(size_t n) {
+        BitMatrix result(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            result.set(i, i);
+        }
+        return result;
+    }
+
+    size_t rows() const noexcept {
+        return rows_;
+    }
+
+    size_t cols() const noexcept {
+        return cols_;
+    }
+
+    size_t words_per_row() const noexcept {
+        return words_per_row_;
+    }
+
+    bool test(size_t i, size_t j) const noexcept {
+        return (words_[i * words_per_row_ + j / word_bits] >> (j % word_bits)) & 1;
+    }
+
+    void set(size_t i, size_t j) noexcept {
+        words_[i * words_per_row_ + j / word_bits] |= word_type{1} << (j % word_bits);
+    }
+
+    void reset(size_t i, size_t j) noexcept {
+        words_[i * words_per_row_ + j / word_bits] &= ~(word_type{1} << (j % word_bits));
+    }
+
+    /**
+     * @brief Указатель на слова i-й строки
+     */
+    word_type* row(size_t i) noexcept {
+        return words_.data() + i * words_per_row_;
+    }
+
+    const word_type* row(size_t i) const noexcept {
+        return words_.data() + i * words_per_row_;
+    }
+
+    /**
+     * @brief Обнулить строку i
+     */
+    void clear_row(size_t i) noexcept {
+        word_type* r = row(i);
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            r[w] = 0;
+        }
+    }
+
+    /**
+     * @brief Строка dest |= строка src
+     */
+    void or_row(size_t dest, size_t src) noexcept {
+        word_type* d = row(dest);
+        const word_type* s = row(src);
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            d[w] |= s[w];
+        }
+    }
+
+    /**
+     * @brief Строка dest |= строка src другой матрицы с тем же числом столбцов
+     */
+    void or_row(size_t dest, const BitMatrix& other, size_t src) noexcept {
+        word_type* d = row(dest);
+        const word_type* s = other.row(src);
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            d[w] |= s[w];
+        }
+    }
+
+    /**
+     * @brief Строка dest &= строка src другой матрицы с тем же числом столбцов
+     */
+    void and_row(size_t dest, const BitMatrix& other, size_t src) noexcept {
+        word_type* d = row(dest);
+        const word_type* s = other.row(src);
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            d[w] &= s[w];
+        }
+    }
+
+    /**
+     * @brief Проверить, что строка i содержится в строке j (как множество столбцов)
+     */
+    bool row_subset_of(size_t i, size_t j) const noexcept {
+        const word_type* a = row(i);
+        const word_type* b = row(j);
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            if (a[w] & ~b[w]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Вызвать f(j) для каждого единичного бита строки i по возрастанию j
+     */
+    template<typename F>
+    void for_each_in_row(size_t i, F f) const {
+        const word_type* r = row(i);
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            word_type bits = r[w];
+            while (bits != 0) {
+                f(w * word_bits + static_cast<size_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Число единичных битов в строке i
+     */
+    size_t row_count(size_t i) const noexcept {
+        const word_type* r = row(i);
+        size_t total = 0;
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            total += static_cast<size_t>(std::popcount(r[w]));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Общее число единичных битов
+     */
+    size_t count() const noexcept {
+        size_t total = 0;
+        for (word_type w : words_) {
+            total += static_cast<size_t>(std::popcount(w));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Транспонированная матрица
+     */
+    BitMatrix transpose() const {
+        BitMatrix result(cols_, rows_);
+        for (size_t i = 0; i < rows_; ++i) {
+            for_each_in_row(i, [&](size_t j) { result.set(j, i); });
+        }
+        return result;
+    }
+
+    /**
+     * @brief Транзитивное замыкание на месте (алгоритм Уоршелла по строкам)
+     *
+     * Для каждого k и каждой строки i с битом (i, k): строка i |= строка k.
+     * Всего O(n³ / 64) пословных операций.
+     *
+     * @throws std::logic_error если матрица не квадратная
+     */
+    void transitive_closure_inplace() {
+        if (rows_ != cols_) {
+            throw std::logic_error("Transitive closure requires a square matrix");
+        }
+        for (size_t k = 0; k < rows_; ++k) {
+            for (size_t i = 0; i < rows_; ++i) {
+                if (i != k && test(i, k)) {
+                    or_row(i, k);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Булево произведение матриц: (A·B)[i][j] = ∨ₖ A[i][k] ∧ B[k][j]
+     *
+     * Метод «четырёх русских»: строки B группируются по 8, для каждой группы
+     * строится таблица из 256 дизъюнкций её подмножеств строк, после чего каждая
+     * строка результата получает одну пословную дизъюнкцию на байт строки A.
+     * Затраты: O(rows · cols_B · inner / (8 · 64)) слов вместо O(rows · inner · cols_B / 64).
+     *
+     * @throws std::domain_error если число столбцов A не равно числу строк B
+     */
+    BitMatrix multiply(const BitMatrix& other) const {
+        require_multipliable(other);
+        BitMatrix result(rows_, other.cols_);
+        multiply_rows(other, result, 0, rows_);
+        return result;
+    }
+
+    /**
+     * @brief Булево произведение с разбиением строк результата между потоками
+     *
+     * Каждый поток обрабатывает непрерывный блок строк со своими таблицами,
+     * поэтому запись в результат не требует синхронизации. Для небольших матриц
+     * (меньше multiply_rows_per_thread строк на поток) используется один поток.
+     * При CRYPTOMATH_PARALLEL = 0 эквивалентно multiply.
+     *
+     * @param thread_count Число потоков; 0 - std::thread::hardware_concurrency()
+     */
+    BitMatrix multiply_parallel(const BitMatrix& other, size_t thread_count = 0) const {
+#if CRYPTOMATH_PARALLEL
+        require_multipliable(other);
+        if (thread_count == 0) {
+            thread_count = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        thread_count = std::min(thread_count, rows_ / multiply_rows_per_thread);
+
+        BitMatrix result(rows_, other.cols_);
+        if (thread_count <= 1) {
+            multiply_rows(other, result, 0, rows_);
+            return result;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(thread_count);
+        const size_t block = (rows_ + thread_count - 1) / thread_count;
+        for (size_t first = 0; first < rows_; first += block) {
+            const size_t last = std::min(first + block, rows_);
+            workers.emplace_back([this, &other, &result, first, last] {
+                multiply_rows(other, result, first, last);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        return result;
+#else
+        (void)thread_count;
+        return multiply(other);
+#endif
+    }
+
+    /**
+     * @brief Минимальное число строк на поток в multiply_parallel
+     *
+     * Построение таблиц стоит столько же, сколько обработка 256 строк, поэтому
+     * меньшие блоки не окупают дублирование таблиц между потоками.
+     */
+    static constexpr size_t multiply_rows_per_thread = 256;
+
+    /**
+     * @brief Поэлементное ИЛИ (объединение отношений)
+     */
+    BitMatrix& operator|=(const BitMatrix& other) {
+        require_same_shape(other);
+        for (size_t w = 0; w < words_.size(); ++w) {
+            words_[w] |= other.words_[w];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Поэлементное И (пересечение отношений)
+     */
+    BitMatrix& operator&=(const BitMatrix& other) {
+        require_same_shape(other);
+        for (size_t w = 0; w < words_.size(); ++w) {
+            words_[w] &= other.words_[w];
+        }
+        return *this;
+    }
+
+    bool operator==(const BitMatrix& other) const {
+        return rows_ == other.rows_ && cols_ == other.cols_ && words_ == other.words_;
+    }
+
+    bool operator!=(const BitMatrix& other) const {
+        return !(*this == other);
+    }
+
+private:
+    // Число строк B в одной таблице метода четырёх русских
+    static constexpr size_t russians_block = 8;
+
+    void require_multipliable(const BitMatrix& other) const {
+        if (cols_ != other.rows_) {
+            throw std::domain_error("Bit matrix dimensions do not match for multiplication");
+        }
+    }
+
+    /**
+     * @brief Вычислить строки [first, last) произведения this · other в result
+     */
+    void multiply_rows(const BitMatrix& other, BitMatrix& result, size_t first, size_t last) const {
+        const size_t width = other.words_per_row_;
+        std::vector<word_type> table((size_t{1} << russians_block) * width, 0);
+
+        for (size_t base = 0; base < cols_; base += russians_block) {
+            const size_t block_rows = std::min(russians_block, cols_ - base);
+            const size_t combinations = size_t{1} << block_rows;
+
+            // table[v] = дизъюнкция строк other с номерами base + (биты v)
+            for (size_t v = 1; v < combinations; ++v) {
+                const word_type* previous = table.data() + (v & (v - 1)) * width;
+                const word_type* added = other.row(base + static_cast<size_t>(std::countr_zero(v)));
+                word_type* current = table.data() + v * width;
+                for (size_t w = 0; w < width; ++w) {
+                    current[w] = previous[w] | added[w];
+                }
+            }
+
+            // Блок из 8 столбцов не пересекает границу слова: 64 кратно 8
+            const size_t word = base / word_bits;
+            const size_t shift = base % word_bits;
+            const word_type mask = combinations - 1;
+            for (size_t i = first; i < last; ++i) {
+                const size_t v = static_cast<size_t>((row(i)[word] >> shift) & mask);
+                if (v == 0) {
+                    continue;
+                }
+                const word_type* source = table.data() + v * width;
+                word_type* target = result.row(i);
+                for (size_t w = 0; w < width; ++w) {
+                    target[w] |= source[w];
+                }
+            }
+        }
+    }
+
+    void require_same_shape(const BitMatrix& other) const {
+        if (rows_ != other.rows_ || cols_ != other.cols_) {
+            throw std::domain_error("Bit matrices must have the same shape");
+        }
+    }
+
+    size_t rows_ = 0;
+    size_t cols_ = 0;
+    size_t words_per_row_ = 0;
+    std::vector<word_type> words_;
+};
+
+} // namespace cryptomath
@@ -34,7 +34,7 @@ public:
         // Строим таблицу
         for (const auto& a : elements_) {
             for (const auto& b : elements_) {
-                table_[std::make_pair(a, b)] = structure.operate(a, b);
+                table_[std::make_pair(a, b)] = structure.operate_unchecked(a, b);
             }
         }
     }
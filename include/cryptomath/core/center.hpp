@@ -30,55 +30,26 @@ public:
 
     /**
      * @brief Вычислить центр группы
+     * 
+     * Центр вычисляется группой один раз как пересечение централизаторов её
+     * порождающих (Group::center), повторные запросы бесплатны.
      */
     static set_type compute(const group_type& group) {
-        set_type center;
-
-        for (const auto& candidate : group.get_set()) {
-            bool commutes_with_all = true;
-
-            for (const auto& g : group.get_set()) {
-                T left = group.operate(candidate, g);
-                T right = group.operate(g, candidate);
-                if (left != right) {
-                    commutes_with_all = false;
-                    break;
-                }
-            }
-
-            if (commutes_with_all) {
-                center.insert(candidate);
-            }
-        }
-
-        return center;
+        return group.center();
     }
 
     /**
      * @brief Получить центр как подгруппу
      */
     static Subgroup<T, Op> as_subgroup(const group_type& group) {
-        set_type center_set = compute(group);
-        return Subgroup<T, Op>(group, center_set);
+        return Subgroup<T, Op>(group, group.center(), trusted_subgroup);
     }
 
     /**
      * @brief Проверить, находится ли элемент в центре
      */
     static bool is_in_center(const group_type& group, const T& element) {
-        if (!group.get_set().contains(element)) {
-            return false;
-        }
-
-        for (const auto& g : group.get_set()) {
-            T left = group.operate(element, g);
-            T right = group.operate(g, element);
-            if (left != right) {
-                return false;
-            }
-        }
-
-        return true;
+        return group.center().contains(element);
     }
 
     /**
@@ -87,23 +58,21 @@ public:
      * Группа абелева тогда и только тогда, когда Z(G) = G
      */
     static bool is_abelian(const group_type& group) {
-        set_type center = compute(group);
-        return center == group.get_set();
+        return group.center().size() == group.get_set().size();
     }
 
     /**
      * @brief Получить размер центра
      */
     static size_t size(const group_type& group) {
-        return compute(group).size();
+        return group.center().size();
     }
 
     /**
      * @brief Проверить, является ли группа бесцентровой (Z(G) = {e})
      */
     static bool is_centerless(const group_type& group) {
-        set_type center = compute(group);
-        return center.size() == 1 && center.contains(group.identity());
+        return group.center().size() == 1;
     }
 };
 
@@ -134,8 +103,8 @@ public:
         set_type centralizer;
 
         for (const auto& g : group.get_set()) {
-            T left = group.operate(g, element);
-            T right = group.operate(element, g);
+            T left = group.operate_unchecked(g, element);
+            T right = group.operate_unchecked(element, g);
             if (left == right) {
                 centralizer.insert(g);
             }
@@ -160,8 +129,8 @@ public:
             return false;
         }
 
-        T left = group.operate(a, b);
-        T right = group.operate(b, a);
+        T left = group.operate_unchecked(a, b);
+        T right = group.operate_unchecked(b, a);
         return left == right;
     }
 };
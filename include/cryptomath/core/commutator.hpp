@@ -0,0 +1,138 @@
+#pragma once
+
+#include "group.hpp"
+#include "subgroup.hpp"
+#include "normal_subgroup.hpp"
+#include "normal_closure.hpp"
+#include <concepts>
+#include <stdexcept>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Коммутант и связанные с ним ряды подгрупп
+ *
+ * Коммутатор элементов [a, b] = a⁻¹ ∘ b⁻¹ ∘ a ∘ b. Для нормальных подгрупп A и B
+ * взаимный коммутант [A, B] - нормальное замыкание коммутаторов порождающих A
+ * и B: в G / [a, b]^G образы порождающих перестановочны, а значит, перестановочны
+ * и сами A и B. Поэтому все вычисления сводятся к NormalClosure над
+ * |порождающих A| · |порождающих B| коммутаторами.
+ */
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class CommutatorSubgroup {
+public:
+    using group_type = Group<T, Op>;
+    using normal_subgroup_type = NormalSubgroup<T, Op>;
+
+    /**
+     * @brief Коммутатор элементов: [a, b] = a⁻¹ ∘ b⁻¹ ∘ a ∘ b
+     */
+    static T commutator(const group_type& group, const T& a, const T& b) {
+        return group.element_at(commutator_index(group, group.index_of(a), group.index_of(b)));
+    }
+
+    /**
+     * @brief Взаимный коммутант [A, B] нормальных подгрупп
+     *
+     * @throws std::domain_error если подгруппы принадлежат разным группам
+     */
+    static normal_subgroup_type compute(const normal_subgroup_type& a, const normal_subgroup_type& b) {
+        if (&a.parent_group() != &b.parent_group()) {
+            throw std::domain_error("Subgroups must be from the same parent group");
+        }
+        const group_type& group = a.parent_group();
+        return NormalClosure<T, Op>::to_normal_subgroup(
+            group, commutator_closure(group, indices_of(group, a.generators()),
+                                      indices_of(group, b.generators())));
+    }
+
+    /**
+     * @brief Коммутант группы G' = [G, G]
+     */
+    static normal_subgroup_type derived_subgroup(const group_type& group) {
+        const std::vector<size_t>& generators = group.generator_indices();
+        return NormalClosure<T, Op>::to_normal_subgroup(
+            group, commutator_closure(group, generators, generators));
+    }
+
+    /**
+     * @brief Ряд коммутантов G = G⁽⁰⁾ ⊵ G⁽¹⁾ ⊵ ..., G⁽ⁱ⁺¹⁾ = [G⁽ⁱ⁾, G⁽ⁱ⁾]
+     *
+     * Ряд обрывается на первом повторившемся члене; каждый член нормален в G.
+     */
+    static std::vector<normal_subgroup_type> derived_series(const group_type& group) {
+        std::vector<normal_subgroup_type> series{improper_normal(group)};
+        while (true) {
+            normal_subgroup_type next = compute(series.back(), series.back());
+            if (next.size() == series.back().size()) {
+                return series;
+            }
+            series.push_back(next);
+        }
+    }
+
+    /**
+     * @brief Нижний центральный ряд G = γ₁ ⊵ γ₂ ⊵ ..., γᵢ₊₁ = [γᵢ, G]
+     */
+    static std::vector<normal_subgroup_type> lower_central_series(const group_type& group) {
+        const normal_subgroup_type whole = improper_normal(group);
+        std::vector<normal_subgroup_type> series{whole};
+        while (true) {
+            normal_subgroup_type next = compute(series.back(), whole);
+            if (next.size() == series.back().size()) {
+                return series;
+            }
+            series.push_back(next);
+        }
+    }
+
+    /**
+     * @brief Проверить разрешимость: ряд коммутантов доходит до {e}
+     */
+    static bool is_solvable(const group_type& group) {
+        return derived_series(group).back().size() == 1;
+    }
+
+    /**
+     * @brief Проверить нильпотентность: нижний центральный ряд доходит до {e}
+     */
+    static bool is_nilpotent(const group_type& group) {
+        return lower_central_series(group).back().size() == 1;
+    }
+
+private:
+    static size_t commutator_index(const group_type& group, size_t a, size_t b) {
+        const size_t inverse_product = group.operate_indices(group.inverse_index(a), group.inverse_index(b));
+        return group.operate_indices(inverse_product, group.operate_indices(a, b));
+    }
+
+    static std::vector<size_t> commutator_closure(const group_type& group,
+                                                  const std::vector<size_t>& a,
+                                                  const std::vector<size_t>& b) {
+        std::vector<size_t> seeds;
+        seeds.reserve(a.size() * b.size());
+        for (size_t x : a) {
+            for (size_t y : b) {
+                seeds.push_back(commutator_index(group, x, y));
+            }
+        }
+        return NormalClosure<T, Op>::closure_indices(group, seeds);
+    }
+
+    static std::vector<size_t> indices_of(const group_type& group, const std::vector<T>& elements) {
+        std::vector<size_t> result;
+        result.reserve(elements.size());
+        for (const auto& x : elements) {
+            result.push_back(group.index_of(x));
+        }
+        return result;
+    }
+
+    static normal_subgroup_type improper_normal(const group_type& group) {
+        return normal_subgroup_type(group, group.get_set(), trusted_subgroup);
+    }
+};
+
+} // namespace cryptomath
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "group.hpp"
+#include "subgroup.hpp"
+#include "set.hpp"
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Разбиение группы на классы сопряжённости
+ *
+ * Класс элемента x - его орбита при сопряжении x ↦ g ∘ x ∘ g⁻¹. Орбита под
+ * действием группы совпадает с орбитой под действием её порождающих, поэтому
+ * классы перечисляются обходом в ширину с сопряжением только порождающими
+ * (Group::generator_indices): O(|G| · |порождающих|) операций на всё разбиение.
+ *
+ * Для каждого элемента хранится номер класса (плотная нумерация в порядке
+ * индексов элементов), для каждого класса - представитель (элемент с
+ * наименьшим индексом), элементы подряд (CSR) и порядок централизатора
+ * представителя |C_G(x)| = |G| / |класс x|.
+ */
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class ConjugacyClasses {
+public:
+    using group_type = Group<T, Op>;
+    using element_type = T;
+    using set_type = Set<T>;
+
+    explicit ConjugacyClasses(const group_type& group)
+        : group_(group) {
+        const size_t n = group_.indexed_elements().size();
+        const std::vector<size_t>& generators = group_.generator_indices();
+        labels_.assign(n, unassigned);
+
+        std::vector<size_t> orbit;
+        for (size_t x = 0; x < n; ++x) {
+            if (labels_[x] != unassigned) {
+                continue;
+            }
+            const size_t label = representatives_.size();
+            representatives_.push_back(x);
+            labels_[x] = label;
+            orbit.assign(1, x);
+            for (size_t head = 0; head < orbit.size(); ++head) {
+                for (size_t s : generators) {
+                    const size_t conjugate = group_.operate_indices(
+                        group_.operate_indices(s, orbit[head]), group_.inverse_index(s));
+                    if (labels_[conjugate] == unassigned) {
+                        labels_[conjugate] = label;
+                        orbit.push_back(conjugate);
+                    }
+                }
+            }
+        }
+
+        // Элементы классов подряд, в каждом классе по возрастанию индексов
+        offsets_.assign(representatives_.size() + 1, 0);
+        for (size_t label : labels_) {
+            ++offsets_[label + 1];
+        }
+        for (size_t c = 0; c < representatives_.size(); ++c) {
+            offsets_[c + 1] += offsets_[c];
+        }
+        members_.resize(n);
+        std::vector<size_t> fill(offsets_.begin(), offsets_.end() - 1);
+        for (size_t x = 0; x < n; ++x) {
+            members_[fill[labels_[x]]++] = x;
+        }
+    }
+
+    /**
+     * @brief Получить группу
+     */
+    const group_type& group() const noexcept {
+        return group_;
+    }
+
+    /**
+     * @brief Число классов сопряжённости
+     */
+    size_t class_count() const noexcept {
+        return representatives_.size();
+    }
+
+    /**
+     * @brief Номера классов по индексам элементов группы
+     */
+    const std::vector<size_t>& labels() const noexcept {
+        return labels_;
+    }
+
+    /**
+     * @brief Номер класса элемента
+     *
+     * @throws std::domain_error если элемент не принадлежит группе
+     */
+    size_t class_of(const T& a) const {
+        return labels_[group_.index_of(a)];
+    }
+
+    /**
+     * @brief Проверить, сопряжены ли a и b
+     */
+    bool are_conjugate(const T& a, const T& b) const {
+        return class_of(a) == class_of(b);
+    }
+
+    /**
+     * @brief Представитель класса c (элемент с наименьшим индексом)
+     */
+    const T& representative(size_t c) const {
+        return group_.element_at(representatives_.at(c));
+    }
+
+    /**
+     * @brief Индексы элементов класса c по возрастанию
+     */
+    std::span<const size_t> members(size_t c) const {
+        if (c >= class_count()) {
+            throw std::out_of_range("Conjugacy class label out of range");
+        }
+        return {members_.data() + offsets_[c], offsets_[c + 1] - offsets_[c]};
+    }
+
+    /**
+     * @brief Размер класса c
+     */
+    size_t class_size(size_t c) const {
+        return members(c).size();
+    }
+
+    /**
+     * @brief Порядок централизатора представителя класса c: |G| / |класс|
+     */
+    size_t centralizer_order(size_t c) const {
+        return labels_.size() / class_size(c);
+    }
+
+    /**
+     * @brief Класс c в виде множества
+     */
+    set_type class_set(size_t c) const {
+        std::vector<T> values;
+        for (size_t x : members(c)) {
+            values.push_back(group_.element_at(x));
+        }
+        return set_type(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Центр группы: объединение одноэлементных классов
+     */
+    set_type center() const {
+        std::vector<T> values;
+        for (size_t c = 0; c < class_count(); ++c) {
+            if (class_size(c) == 1) {
+                values.push_back(representative(c));
+            }
+        }
+        return set_type(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Проверить нормальность подгруппы за O(|N|)
+     *
+     * Подгруппа нормальна тогда и только тогда, когда она является объединением
+     * классов сопряжённости: для каждого задетого класса все его элементы лежат в N.
+     */
+    bool is_normal(const Subgroup<T, Op>& subgroup) const {
+        if (&subgroup.parent_group() != &group_) {
+            throw std::domain_error("Subgroup must be from the same group");
+        }
+        std::vector<size_t> hits(class_count(), 0);
+        for (const auto& n : subgroup.get_subset()) {
+            ++hits[class_of(n)];
+        }
+        for (size_t c = 0; c < class_count(); ++c) {
+            if (hits[c] != 0 && hits[c] != class_size(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Проверить уравнение классов: |G| = |Z(G)| + Σ [G : C_G(xᵢ)]
+     *
+     * Сумма берётся по представителям нецентральных классов; дополнительно
+     * проверяется, что размер каждого класса делит |G|.
+     */
+    bool verify_class_equation() const {
+        const size_t order = labels_.size();
+        size_t center_size = 0;
+        size_t noncentral_total = 0;
+        for (size_t c = 0; c < class_count(); ++c) {
+            const size_t size = class_size(c);
+            if (order % size != 0) {
+                return false;
+            }
+            if (size == 1) {
+                ++center_size;
+            } else {
+                noncentral_total += order / centralizer_order(c);
+            }
+        }
+        return order == center_size + noncentral_total &&
+               center_size == group_.center().size();
+    }
+
+private:
+    static constexpr size_t unassigned = std::numeric_limits<size_t>::max();
+
+    const group_type& group_;
+    std::vector<size_t> labels_;          // labels_[x] - класс элемента с индексом x
+    std::vector<size_t> representatives_; // Индекс представителя каждого класса
+    std::vector<size_t> offsets_;         // Начало каждого класса в members_
+    std::vector<size_t> members_;         // Индексы элементов, сгруппированные по классам
+};
+
+} // namespace cryptomath
@@ -3,10 +3,65 @@
 #include "subgroup.hpp"
 #include "group.hpp"
 #include <concepts>
-#include <map>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace cryptomath {
 
+namespace detail {
+
+/**
+ * @brief Номера смежных классов подгруппы над индексами элементов группы
+ */
+struct CosetLabels {
+    std::vector<size_t> labels;          // labels[i] - номер класса element_at(i)
+    std::vector<size_t> representatives; // Наименьший индекс элемента в каждом классе
+};
+
+/**
+ * @brief Разметить левые (g ∘ H) или правые (H ∘ g) смежные классы за |G| операций
+ * 
+ * Элементы перебираются по возрастанию индексов; первый неразмеченный элемент g
+ * открывает новый класс, и все g ∘ h (или h ∘ g), h ∈ H, получают его номер.
+ */
+template<typename T, typename Op>
+CosetLabels coset_labels(const Group<T, Op>& group, const Subgroup<T, Op>& subgroup, bool left) {
+    constexpr size_t unassigned = std::numeric_limits<size_t>::max();
+    const size_t n = group.indexed_elements().size();
+
+    std::vector<size_t> members;
+    members.reserve(subgroup.size());
+    for (const auto& h : subgroup.get_subset()) {
+        members.push_back(group.index_of(h));
+    }
+
+    CosetLabels result;
+    result.labels.assign(n, unassigned);
+    for (size_t g = 0; g < n; ++g) {
+        if (result.labels[g] != unassigned) {
+            continue;
+        }
+        const size_t label = result.representatives.size();
+        result.representatives.push_back(g);
+        for (size_t h : members) {
+            result.labels[left ? group.operate_indices(g, h) : group.operate_indices(h, g)] = label;
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class CosetTable;
+
 /**
  * @brief Смежный класс подгруппы
  * 
@@ -18,6 +73,15 @@ namespace cryptomath {
  * - Два смежных класса либо равны, либо не пересекаются
  * - Все смежные классы имеют одинаковый размер |H|
  * - Теорема Лагранжа: |G| = |H| × [G : H], где [G : H] - индекс
+ * 
+ * Смежный класс - представление (представитель, ссылка на подгруппу): элементы
+ * вычисляются при обходе итератором, а множество строится только по запросу
+ * get_coset(). Принадлежность проверяется одной операцией и поиском в H.
+ * Класс, выданный CosetTable, знает свой номер в таблице и разделяет с ней
+ * владение разметкой: принадлежность и равенство классов той же таблицы
+ * сводятся к сравнению номеров, а класс остаётся корректным после копирования,
+ * перемещения или уничтожения таблицы. Группа и подгруппа, как и для
+ * любого класса, должны его пережить.
  */
 template<typename T, typename Op>
     requires GroupConcept<T, Op>
@@ -33,20 +97,96 @@ public:
         RIGHT   // Правый смежный класс: H ∘ g
     };
 
+    /**
+     * @brief Итератор по элементам класса: g ∘ h (или h ∘ g) для h ∈ H по порядку H
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        const_iterator() = default;
+
+        T operator*() const {
+            return coset_->type_ == CosetType::LEFT
+                ? coset_->group_.operate_unchecked(coset_->representative_, *position_)
+                : coset_->group_.operate_unchecked(*position_, coset_->representative_);
+        }
+
+        const_iterator& operator++() {
+            ++position_;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++position_;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return position_ == other.position_;
+        }
+
+    private:
+        friend class Coset;
+
+        const_iterator(const Coset* coset, typename set_type::const_iterator position)
+            : coset_(coset), position_(position) {}
+
+        const Coset* coset_ = nullptr;
+        typename set_type::const_iterator position_{};
+    };
+
     /**
      * @brief Построить левый смежный класс: g ∘ H
      */
     Coset(const group_type& group, const subgroup_type& subgroup,
           const T& representative, CosetType type = CosetType::LEFT)
-        : group_(group), subgroup_(subgroup), representative_(representative), type_(type) {
-        build_coset();
+        : group_(group), subgroup_(subgroup), representative_(representative),
+          representative_inverse_(group.inverse(representative)), type_(type) {
+        // group.inverse выбрасывает std::domain_error, если представитель не в группе
+    }
+
+    /**
+     * @brief Номер класса в таблице, если класс получен из CosetTable
+     */
+    std::optional<size_t> label() const noexcept {
+        if (labels_ == nullptr) {
+            return std::nullopt;
+        }
+        return label_;
     }
 
     /**
      * @brief Получить смежный класс как множество
+     * 
+     * Множество строится при первом обращении и кэшируется.
+     */
+    const set_type& get_coset() const {
+        if (!coset_.has_value()) {
+            std::vector<T> values(begin(), end());
+            coset_ = set_type(values.begin(), values.end());
+        }
+        return *coset_;
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, subgroup_.get_subset().begin());
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, subgroup_.get_subset().end());
+    }
+
+    /**
+     * @brief Вид смежного класса: левый или правый
      */
-    const set_type& get_coset() const noexcept {
-        return coset_;
+    CosetType type() const noexcept {
+        return type_;
     }
 
     /**
@@ -65,27 +205,49 @@ public:
 
     /**
      * @brief Проверить, находится ли элемент в смежном классе
+     * 
+     * x ∈ g ∘ H ⟺ g⁻¹ ∘ x ∈ H, x ∈ H ∘ g ⟺ x ∘ g⁻¹ ∈ H.
+     * Для класса из CosetTable - сравнение номера класса x с номером этого класса.
      */
     bool contains(const T& element) const {
-        return coset_.contains(element);
+        if (labels_ != nullptr) {
+            auto index = group_.find_index(element);
+            return index.has_value() && (*labels_)[*index] == label_;
+        }
+        if (!group_.get_set().contains(element)) {
+            return false;
+        }
+        if (type_ == CosetType::LEFT) {
+            return subgroup_.contains(group_.operate_unchecked(representative_inverse_, element));
+        }
+        return subgroup_.contains(group_.operate_unchecked(element, representative_inverse_));
     }
 
     /**
      * @brief Получить размер смежного класса (всегда равен |H|)
      */
     size_t size() const noexcept {
-        return coset_.size();
+        return subgroup_.size();
     }
 
     /**
      * @brief Проверить равенство смежных классов
      * 
-     * Два смежных класса равны тогда и только тогда, когда они имеют одинаковые элементы
+     * Два смежных класса равны тогда и только тогда, когда они имеют одинаковые элементы.
+     * Классы одного вида равны, если представитель одного лежит в другом; левый
+     * и правый классы сравниваются как множества.
      */
     bool operator==(const Coset& other) const {
-        return &group_ == &other.group_ &&
-               &subgroup_ == &other.subgroup_ &&
-               coset_ == other.coset_;
+        if (&group_ != &other.group_ || &subgroup_ != &other.subgroup_) {
+            return false;
+        }
+        if (labels_ != nullptr && labels_ == other.labels_) {
+            return label_ == other.label_;
+        }
+        if (type_ == other.type_) {
+            return contains(other.representative_);
+        }
+        return get_coset() == other.get_coset();
     }
 
     /**
@@ -96,29 +258,159 @@ public:
     }
 
 private:
-    void build_coset() {
-        const auto& H = subgroup_.get_subset();
-        
-        if (type_ == CosetType::LEFT) {
-            // Левый смежный класс: g ∘ H
-            for (const auto& h : H) {
-                T element = group_.operate(representative_, h);
-                coset_.insert(element);
-            }
-        } else {
-            // Правый смежный класс: H ∘ g
-            for (const auto& h : H) {
-                T element = group_.operate(h, representative_);
-                coset_.insert(element);
-            }
-        }
+    friend class CosetTable<T, Op>;
+
+    /**
+     * @brief Класс с номером label в разметке labels (см. CosetTable::coset)
+     */
+    Coset(const group_type& group, const subgroup_type& subgroup, const T& representative,
+          CosetType type, std::shared_ptr<const std::vector<size_t>> labels, size_t label)
+        : Coset(group, subgroup, representative, type) {
+        labels_ = std::move(labels);
+        label_ = label;
     }
 
     const group_type& group_;
     const subgroup_type& subgroup_;
     T representative_;
+    T representative_inverse_;
     CosetType type_;
-    set_type coset_;
+    std::shared_ptr<const std::vector<size_t>> labels_; // Разметка таблицы, выдавшей класс
+    size_t label_ = 0;                                  // Номер класса в labels_
+    mutable std::optional<set_type> coset_; // Лениво построенное множество элементов
+};
+
+/**
+ * @brief Таблица смежных классов: номер класса для каждого элемента группы
+ * 
+ * Классы размечаются один раз за |G| операций (detail::coset_labels) и
+ * нумеруются по наименьшему индексу элемента; представитель класса - этот
+ * элемент. Принадлежность и равенство классов проверяются сравнением номеров,
+ * а память - один номер на элемент группы вместо копии класса на каждый класс.
+ * Разметка неизменяема и разделяется с выданными классами через shared_ptr.
+ */
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class CosetTable {
+public:
+    using element_type = T;
+    using group_type = Group<T, Op>;
+    using subgroup_type = Subgroup<T, Op>;
+    using coset_type = Coset<T, Op>;
+    using set_type = Set<T>;
+
+    /**
+     * @brief Разметить левые (по умолчанию) или правые смежные классы подгруппы
+     * 
+     * @throws std::domain_error если подгруппа взята из другой группы
+     */
+    CosetTable(const group_type& group, const subgroup_type& subgroup,
+               typename coset_type::CosetType type = coset_type::CosetType::LEFT)
+        : group_(group), subgroup_(subgroup), type_(type) {
+        if (&subgroup.parent_group() != &group) {
+            throw std::domain_error("Subgroup must be from the same parent group");
+        }
+        detail::CosetLabels cosets =
+            detail::coset_labels(group_, subgroup_, type == coset_type::CosetType::LEFT);
+        labels_ = std::make_shared<const std::vector<size_t>>(std::move(cosets.labels));
+        representatives_ = std::move(cosets.representatives);
+    }
+
+    /**
+     * @brief Индекс [G : H] - число смежных классов
+     */
+    size_t index() const noexcept {
+        return representatives_.size();
+    }
+
+    /**
+     * @brief Номера классов по индексам элементов группы
+     */
+    const std::vector<size_t>& labels() const noexcept {
+        return *labels_;
+    }
+
+    /**
+     * @brief Номер класса, содержащего x
+     * 
+     * @throws std::domain_error если элемент не принадлежит группе
+     */
+    size_t label_of(const T& x) const {
+        return (*labels_)[group_.index_of(x)];
+    }
+
+    /**
+     * @brief Проверить, лежат ли a и b в одном смежном классе
+     */
+    bool same_coset(const T& a, const T& b) const {
+        return label_of(a) == label_of(b);
+    }
+
+    /**
+     * @brief Представитель класса c (элемент с наименьшим индексом)
+     */
+    const T& representative(size_t c) const {
+        require_coset(c);
+        return group_.element_at(representatives_[c]);
+    }
+
+    /**
+     * @brief Индексы представителей классов, по номерам
+     */
+    const std::vector<size_t>& representative_indices() const noexcept {
+        return representatives_;
+    }
+
+    /**
+     * @brief Класс c как представление (представитель, подгруппа, номер в таблице)
+     */
+    coset_type coset(size_t c) const {
+        return coset_type(group_, subgroup_, representative(c), type_, labels_, c);
+    }
+
+    /**
+     * @brief Все классы как представления, по номерам
+     */
+    std::vector<coset_type> cosets() const {
+        std::vector<coset_type> result;
+        result.reserve(index());
+        for (size_t c = 0; c < index(); ++c) {
+            result.push_back(coset(c));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Элементы каждого класса как множества, по номерам
+     * 
+     * Группировка по номерам за один проход по группе, без повторных операций.
+     */
+    std::vector<set_type> coset_sets() const {
+        std::vector<std::vector<T>> members(index());
+        const std::vector<size_t>& labels = *labels_;
+        for (size_t i = 0; i < labels.size(); ++i) {
+            members[labels[i]].push_back(group_.element_at(i));
+        }
+        std::vector<set_type> result;
+        result.reserve(index());
+        for (const auto& values : members) {
+            result.emplace_back(values.begin(), values.end());
+        }
+        return result;
+    }
+
+private:
+    void require_coset(size_t c) const {
+        if (c >= index()) {
+            throw std::out_of_range("Coset number out of range");
+        }
+    }
+
+    const group_type& group_;
+    const subgroup_type& subgroup_;
+    typename coset_type::CosetType type_;
+    std::shared_ptr<const std::vector<size_t>> labels_; // Номер класса для каждого индекса элемента
+    std::vector<size_t> representatives_;               // Индекс представителя каждого класса
 };
 
 /**
@@ -152,43 +444,22 @@ public:
 
     /**
      * @brief Вычислить индекс [G : H] (количество левых смежных классов)
+     * 
+     * Классы размечаются таблицей CosetTable за |G| операций, без построения множеств.
      */
     static size_t compute_index(const group_type& group, const subgroup_type& subgroup) {
-        return find_all_cosets(group, subgroup).size();
+        return CosetTable<T, Op>(group, subgroup).index();
     }
 
     /**
      * @brief Найти все различные левые смежные классы
+     * 
+     * Для перебора классов без копий множеств используйте CosetTable.
      */
     static Set<Set<T>> find_all_cosets(const group_type& group,
                                        const subgroup_type& subgroup) {
-        Set<Set<T>> cosets;
-        Set<T> processed;
-
-        for (const auto& g : group.get_set()) {
-            // Пропускаем, если уже в обработанном смежном классе
-            bool in_processed = false;
-            for (const auto& coset : cosets) {
-                if (coset.contains(g)) {
-                    in_processed = true;
-                    break;
-                }
-            }
-            if (in_processed) {
-                continue;
-            }
-
-            // Строим смежный класс для этого представителя
-            Coset<T, Op> coset(group, subgroup, g, Coset<T, Op>::CosetType::LEFT);
-            cosets.insert(coset.get_coset());
-
-            // Помечаем все элементы этого смежного класса как обработанные
-            for (const auto& element : coset.get_coset()) {
-                processed.insert(element);
-            }
-        }
-
-        return cosets;
+        const auto sets = CosetTable<T, Op>(group, subgroup).coset_sets();
+        return Set<Set<T>>(sets.begin(), sets.end());
     }
 
     /**
@@ -247,28 +518,8 @@ public:
      */
     static coset_set right_coset_partition(const group_type& group,
                                            const subgroup_type& subgroup) {
-        coset_set cosets;
-        Set<T> processed;
-
-        for (const auto& g : group.get_set()) {
-            // Пропускаем, если уже обработан
-            bool in_processed = false;
-            for (const auto& coset : cosets) {
-                if (coset.contains(g)) {
-                    in_processed = true;
-                    break;
-                }
-            }
-            if (in_processed) {
-                continue;
-            }
-
-            // Строим правый смежный класс
-            Coset<T, Op> coset(group, subgroup, g, Coset<T, Op>::CosetType::RIGHT);
-            cosets.insert(coset.get_coset());
-        }
-
-        return cosets;
+        const auto sets = CosetTable<T, Op>(group, subgroup, Coset<T, Op>::CosetType::RIGHT).coset_sets();
+        return coset_set(sets.begin(), sets.end());
     }
 
     /**
@@ -280,28 +531,21 @@ public:
      */
     static bool verify_partition(const group_type& group,
                                  const coset_set& cosets) {
-        // Проверяем, что объединение равно группе
-        Set<T> union_set;
+        // Каждый элемент группы должен встретиться ровно в одном классе:
+        // отметки по индексам вместо попарных пересечений классов
+        std::vector<bool> covered(group.indexed_elements().size(), false);
+        size_t total = 0;
         for (const auto& coset : cosets) {
-            union_set = union_set.union_with(coset);
-        }
-        if (union_set != group.get_set()) {
-            return false;
-        }
-
-        // Проверяем попарную непересекаемость
-        for (auto it1 = cosets.begin(); it1 != cosets.end(); ++it1) {
-            auto it2 = it1;
-            ++it2;
-            for (; it2 != cosets.end(); ++it2) {
-                Set<T> intersection = it1->intersection(*it2);
-                if (!intersection.empty()) {
+            for (const auto& element : coset) {
+                auto index = group.find_index(element);
+                if (!index.has_value() || covered[*index]) {
                     return false;
                 }
+                covered[*index] = true;
+                ++total;
             }
         }
-
-        return true;
+        return total == covered.size();
     }
 };
 
@@ -125,13 +125,13 @@ public:
                     break; // Нашли цикл
                 }
                 subgroup.insert(current);
-                current = group.operate(current, generator);
+                current = group.operate_unchecked(current, generator);
             }
         } else {
             // Генерируем ровно ord(g) элементов
             for (size_t i = 1; i < *order; ++i) {
                 subgroup.insert(current);
-                current = group.operate(current, generator);
+                current = group.operate_unchecked(current, generator);
             }
         }
 
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Система непересекающихся множеств (union-find) над индексами 0..n-1
+ *
+ * Объединение по размеру и сжатие путей делением пополам дают почти константную
+ * амортизированную стоимость операций (обратная функция Аккермана).
+ */
+class DisjointSetUnion {
+public:
+    explicit DisjointSetUnion(size_t n)
+        : parent_(n), size_(n, 1), set_count_(n) {
+        std::iota(parent_.begin(), parent_.end(), size_t{0});
+    }
+
+    /**
+     * @brief Найти представителя множества, содержащего x
+     */
+    size_t find(size_t x) noexcept {
+        while (parent_[x] != x) {
+            parent_[x] = parent_[parent_[x]];
+            x = parent_[x];
+        }
+        return x;
+    }
+
+    /**
+     * @brief Объединить множества, содержащие a и b
+     *
+     * @return true если множества были различны
+     */
+    bool unite(size_t a, size_t b) noexcept {
+        a = find(a);
+        b = find(b);
+        if (a == b) {
+            return false;
+        }
+        if (size_[a] < size_[b]) {
+            std::swap(a, b);
+        }
+        parent_[b] = a;
+        size_[a] += size_[b];
+        --set_count_;
+        return true;
+    }
+
+    /**
+     * @brief Проверить, лежат ли a и b в одном множестве
+     */
+    bool same(size_t a, size_t b) noexcept {
+        return find(a) == find(b);
+    }
+
+    /**
+     * @brief Число непересекающихся множеств
+     */
+    size_t set_count() const noexcept {
+        return set_count_;
+    }
+
+    /**
+     * @brief Плотная нумерация множеств: labels[x] ∈ [0, set_count())
+     *
+     * Номера присваиваются в порядке первого появления при обходе x = 0, 1, ...
+     */
+    std::vector<size_t> labels() {
+        constexpr size_t unassigned = static_cast<size_t>(-1);
+        std::vector<size_t> root_label(parent_.size(), unassigned);
+        std::vector<size_t> result(parent_.size());
+        size_t next = 0;
+        for (size_t x = 0; x < parent_.size(); ++x) {
+            const size_t root = find(x);
+            if (root_label[root] == unassigned) {
+                root_label[root] = next++;
+            }
+            result[x] = root_label[root];
+        }
+        return result;
+    }
+
+private:
+    std::vector<size_t> parent_;
+    std::vector<size_t> size_;
+    size_t set_count_;
+};
+
+} // namespace cryptomath
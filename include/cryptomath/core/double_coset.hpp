@@ -0,0 +1,258 @@
+#pragma once
+
+#include "group.hpp"
+#include "subgroup.hpp"
+#include "coset.hpp"
+#include "set.hpp"
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Разбиение группы на двойные смежные классы H \ G / K
+ *
+ * Двойной смежный класс H ∘ g ∘ K - объединение левых классов x ∘ K, x ∈ H ∘ g.
+ * Левые классы по K размечаются один раз за |G| операций
+ * (detail::coset_labels), после чего H действует на их номера умножением
+ * слева: h · (x ∘ K) = (h ∘ x) ∘ K. Двойные классы - орбиты этого действия;
+ * орбиты под действием H совпадают с орбитами под действием её порождающих,
+ * поэтому обход в ширину стоит O([G : K] · |порождающих H|) операций.
+ * Каждое умножение идёт через operate_indices: операция группы и двоичный
+ * поиск индекса результата за O(log |G|) сравнений. Итого с разметкой
+ * O(|G| + [G : K] · |порождающих H|) операций группы и
+ * O((|G| + [G : K] · |порождающих H|) · log |G|) сравнений.
+ *
+ * Для каждого двойного класса хранятся представитель (элемент с наименьшим
+ * индексом), номера его левых классов по K подряд (CSR) и размер
+ * |H ∘ g ∘ K| = (число левых классов) · |K|. Элементы не материализуются:
+ * их можно перебрать потоком через for_each_element.
+ */
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class DoubleCosets {
+public:
+    using group_type = Group<T, Op>;
+    using element_type = T;
+    using set_type = Set<T>;
+    using subgroup_type = Subgroup<T, Op>;
+
+    /**
+     * @brief Описание одного двойного смежного класса
+     */
+    struct Entry {
+        size_t index;         // Номер двойного класса
+        T representative;     // Представитель g
+        size_t size;          // |H ∘ g ∘ K|
+    };
+
+    /**
+     * @brief Итератор по двойным смежным классам
+     *
+     * Значения Entry строятся при разыменовании, поэтому перебор не создаёт
+     * множеств элементов.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Entry;
+
+        const_iterator() = default;
+
+        Entry operator*() const {
+            return {index_, owner_->representative(index_), owner_->size(index_)};
+        }
+
+        const_iterator& operator++() {
+            ++index_;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++index_;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept {
+            return index_ == other.index_;
+        }
+
+    private:
+        friend class DoubleCosets;
+
+        const_iterator(const DoubleCosets* owner, size_t index)
+            : owner_(owner), index_(index) {}
+
+        const DoubleCosets* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    /**
+     * @brief Разбить группу на двойные смежные классы H \ G / K
+     *
+     * @throws std::domain_error если подгруппы взяты из другой группы
+     */
+    DoubleCosets(const group_type& group, const subgroup_type& left, const subgroup_type& right)
+        : group_(group), left_(left), right_(right) {
+        if (&left.parent_group() != &group || &right.parent_group() != &group) {
+            throw std::domain_error("Subgroups must be from the same parent group");
+        }
+
+        detail::CosetLabels cosets = detail::coset_labels(group_, right_, true);
+        coset_labels_ = std::move(cosets.labels);
+        coset_representatives_ = std::move(cosets.representatives);
+        const size_t coset_count = coset_representatives_.size();
+
+        std::vector<size_t> generators;
+        for (const auto& h : left_.generators()) {
+            generators.push_back(group_.index_of(h));
+        }
+
+        // Обход в ширину по номерам левых классов; орбиты ложатся в members_ подряд
+        double_labels_.assign(coset_count, unassigned);
+        members_.reserve(coset_count);
+        offsets_.push_back(0);
+        for (size_t start = 0; start < coset_count; ++start) {
+            if (double_labels_[start] != unassigned) {
+                continue;
+            }
+            const size_t label = representatives_.size();
+            representatives_.push_back(coset_representatives_[start]);
+            double_labels_[start] = label;
+            members_.push_back(start);
+
+            for (size_t head = offsets_.back(); head < members_.size(); ++head) {
+                const size_t x = coset_representatives_[members_[head]];
+                for (size_t s : generators) {
+                    const size_t next = coset_labels_[group_.operate_indices(s, x)];
+                    if (double_labels_[next] == unassigned) {
+                        double_labels_[next] = label;
+                        members_.push_back(next);
+                    }
+                }
+            }
+            offsets_.push_back(members_.size());
+        }
+    }
+
+    /**
+     * @brief Число двойных смежных классов |H \ G / K|
+     */
+    size_t count() const noexcept {
+        return representatives_.size();
+    }
+
+    /**
+     * @brief Номер двойного класса, содержащего x
+     *
+     * @throws std::domain_error если элемент не принадлежит группе
+     */
+    size_t label_of(const T& x) const {
+        return double_labels_[coset_labels_[group_.index_of(x)]];
+    }
+
+    /**
+     * @brief Проверить, лежат ли a и b в одном двойном классе: b ∈ H ∘ a ∘ K
+     */
+    bool same_double_coset(const T& a, const T& b) const {
+        return label_of(a) == label_of(b);
+    }
+
+    /**
+     * @brief Представитель двойного класса d (элемент с наименьшим индексом)
+     */
+    T representative(size_t d) const {
+        require_double_coset(d);
+        return group_.element_at(representatives_[d]);
+    }
+
+    /**
+     * @brief Размер двойного класса d: |H ∘ g ∘ K| = |H| · |K| / |H ∩ g ∘ K ∘ g⁻¹|
+     */
+    size_t size(size_t d) const {
+        require_double_coset(d);
+        return (offsets_[d + 1] - offsets_[d]) * right_.size();
+    }
+
+    /**
+     * @brief Номера левых классов x ∘ K, составляющих двойной класс d
+     */
+    std::span<const size_t> right_cosets(size_t d) const {
+        require_double_coset(d);
+        return {members_.data() + offsets_[d], offsets_[d + 1] - offsets_[d]};
+    }
+
+    /**
+     * @brief Перебрать элементы двойного класса d без их материализации
+     *
+     * f вызывается как f(x) для каждого x ∈ H ∘ g ∘ K ровно один раз.
+     */
+    template<typename F>
+    void for_each_element(size_t d, F f) const {
+        for (size_t c : right_cosets(d)) {
+            const T& x = group_.element_at(coset_representatives_[c]);
+            for (const auto& k : right_.get_subset()) {
+                f(group_.operate_unchecked(x, k));
+            }
+        }
+    }
+
+    /**
+     * @brief Двойной класс d как множество
+     */
+    set_type double_coset_set(size_t d) const {
+        std::vector<T> values;
+        values.reserve(size(d));
+        for_each_element(d, [&](const T& x) { values.push_back(x); });
+        return set_type(values.begin(), values.end());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, count());
+    }
+
+    /**
+     * @brief Проверить, что размеры двойных классов в сумме дают |G|
+     */
+    bool verify_partition() const {
+        size_t total = 0;
+        for (size_t d = 0; d < count(); ++d) {
+            total += size(d);
+        }
+        return total == group_.indexed_elements().size();
+    }
+
+private:
+    static constexpr size_t unassigned = std::numeric_limits<size_t>::max();
+
+    void require_double_coset(size_t d) const {
+        if (d >= count()) {
+            throw std::out_of_range("Double coset number out of range");
+        }
+    }
+
+    const group_type& group_;
+    const subgroup_type& left_;
+    const subgroup_type& right_;
+    std::vector<size_t> coset_labels_;           // Номер левого класса по K для каждого элемента
+    std::vector<size_t> coset_representatives_;  // Представитель каждого левого класса по K
+    std::vector<size_t> double_labels_;          // Номер двойного класса для каждого левого класса
+    std::vector<size_t> representatives_;        // Индекс представителя двойного класса
+    std::vector<size_t> offsets_;                // Начало левых классов двойного класса в members_
+    std::vector<size_t> members_;                // Левые классы, сгруппированные по двойным
+};
+
+} // namespace cryptomath
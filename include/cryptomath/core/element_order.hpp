@@ -52,7 +52,7 @@ public:
             if (current == group.identity()) {
                 return n;
             }
-            current = group.operate(current, element);
+            current = group.operate_unchecked(current, element);
         }
 
         // Если не нашли единицу после |G| шагов, элемент имеет бесконечный порядок
@@ -204,6 +204,10 @@ public:
      */
     static std::optional<size_t> via_cyclic_subgroup(const group_type& group,
                                                       const T& element) {
+        if (!group.get_set().contains(element)) {
+            throw std::domain_error("Element not in group");
+        }
+
         Set<T> cyclic_subgroup;
         cyclic_subgroup.insert(group.identity());
         
@@ -215,7 +219,7 @@ public:
                 return n;
             }
             cyclic_subgroup.insert(current);
-            current = group.operate(current, element);
+            current = group.operate_unchecked(current, element);
             
             // Если мы уже видели этот элемент, мы нашли цикл
             if (cyclic_subgroup.contains(current) && current != group.identity()) {
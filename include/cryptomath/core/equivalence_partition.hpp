@@ -0,0 +1,143 @@
+#pragma once
+
+#include "set.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Разбиение конечного множества на классы эквивалентности
+ *
+ * Хранит номер класса для каждого элемента (в порядке возрастания элементов)
+ * и элементы каждого класса подряд в одном массиве (CSR). Классы пронумерованы
+ * в порядке наименьших элементов: класс 0 содержит наименьший элемент множества.
+ */
+template<typename T>
+class EquivalencePartition {
+public:
+    using element_type = T;
+    using set_type = Set<T>;
+
+    EquivalencePartition() = default;
+
+    /**
+     * @brief Построить разбиение по упорядоченным элементам и плотным меткам классов
+     *
+     * @param elements Элементы множества по возрастанию
+     * @param labels labels[i] - номер класса elements[i], номера из [0, class_count)
+     * @param class_count Число классов
+     */
+    EquivalencePartition(std::vector<T> elements, std::vector<size_t> labels, size_t class_count)
+        : elements_(std::move(elements)), labels_(std::move(labels)),
+          offsets_(class_count + 1, 0) {
+        if (labels_.size() != elements_.size()) {
+            throw std::invalid_argument("Labels must be given for every element");
+        }
+        for (size_t label : labels_) {
+            ++offsets_[label + 1];
+        }
+        for (size_t c = 0; c < class_count; ++c) {
+            offsets_[c + 1] += offsets_[c];
+        }
+
+        // Элементы обходятся по возрастанию, поэтому каждый класс тоже упорядочен
+        members_.resize(elements_.size());
+        std::vector<size_t> fill(offsets_.begin(), offsets_.end() - 1);
+        for (size_t i = 0; i < elements_.size(); ++i) {
+            members_[fill[labels_[i]]++] = i;
+        }
+    }
+
+    /**
+     * @brief Число классов эквивалентности
+     */
+    size_t class_count() const noexcept {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    /**
+     * @brief Метки классов по индексам элементов
+     */
+    const std::vector<size_t>& labels() const noexcept {
+        return labels_;
+    }
+
+    /**
+     * @brief Элементы множества в порядке индексов
+     */
+    const std::vector<T>& elements() const noexcept {
+        return elements_;
+    }
+
+    /**
+     * @brief Номер класса элемента
+     *
+     * @throws std::domain_error если элемент не принадлежит множеству
+     */
+    size_t class_of(const T& a) const {
+        auto it = std::lower_bound(elements_.begin(), elements_.end(), a);
+        if (it == elements_.end() || a < *it) {
+            throw std::domain_error("Element not in partitioned set");
+        }
+        return labels_[static_cast<size_t>(it - elements_.begin())];
+    }
+
+    /**
+     * @brief Проверить, лежат ли a и b в одном классе
+     */
+    bool equivalent(const T& a, const T& b) const {
+        return class_of(a) == class_of(b);
+    }
+
+    /**
+     * @brief Индексы элементов класса c по возрастанию
+     */
+    std::span<const size_t> members(size_t c) const {
+        if (c >= class_count()) {
+            throw std::out_of_range("Equivalence class label out of range");
+        }
+        return {members_.data() + offsets_[c], offsets_[c + 1] - offsets_[c]};
+    }
+
+    /**
+     * @brief Размер класса c
+     */
+    size_t class_size(size_t c) const {
+        return members(c).size();
+    }
+
+    /**
+     * @brief Класс c в виде множества
+     */
+    set_type class_set(size_t c) const {
+        std::vector<T> values;
+        values.reserve(class_size(c));
+        for (size_t i : members(c)) {
+            values.push_back(elements_[i]);
+        }
+        return set_type(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Все классы в виде множества множеств (фактор-множество)
+     */
+    Set<set_type> to_set() const {
+        Set<set_type> result;
+        for (size_t c = 0; c < class_count(); ++c) {
+            result.insert(class_set(c));
+        }
+        return result;
+    }
+
+private:
+    std::vector<T> elements_;     // Элементы множества по возрастанию
+    std::vector<size_t> labels_;  // labels_[i] - класс i-го элемента
+    std::vector<size_t> offsets_; // Начало каждого класса в members_
+    std::vector<size_t> members_; // Индексы элементов, сгруппированные по классам
+};
+
+} // namespace cryptomath
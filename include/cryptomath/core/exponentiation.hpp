@@ -0,0 +1,349 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Алгоритмы возведения в степень для ассоциативных операций
+ *
+ * Функции этого файла работают с произвольной ассоциативной операцией mul(a, b)
+ * и используются методами power() полугрупп, моноидов и групп. Операция
+ * передаётся как функциональный объект, поэтому её вызов встраивается.
+ */
+namespace detail {
+
+/**
+ * @brief Ширина окна для скользящего окна в зависимости от длины показателя
+ *
+ * Для коротких показателей таблица нечётных степеней не окупается,
+ * поэтому используется обычное двоичное возведение (ширина 1).
+ */
+inline size_t sliding_window_width(size_t exponent_bits) noexcept {
+    if (exponent_bits <= 8) {
+        return 1;
+    }
+    if (exponent_bits <= 24) {
+        return 3;
+    }
+    if (exponent_bits <= 48) {
+        return 4;
+    }
+    return 5;
+}
+
+/**
+ * @brief Возведение в степень методом скользящего окна (слева направо): a^n
+ *
+ * Предвычисляет нечётные степени a, a³, ..., a^(2^w - 1) и обрабатывает показатель
+ * окнами до w бит, каждое из которых заканчивается единичным битом. Требует
+ * bit_length(n) - 1 возведений в квадрат и примерно bit_length(n) / (w + 1)
+ * умножений вместо bit_length(n) / 2 у двоичного метода.
+ *
+ * Предусловие: n ≥ 1 (единичный элемент не требуется, поэтому подходит для полугрупп).
+ */
+template<typename T, typename Mul>
+T sliding_window_power(const T& a, size_t n, Mul mul) {
+    const size_t bits = static_cast<size_t>(std::bit_width(n));
+    const size_t width = sliding_window_width(bits);
+
+    if (width == 1) {
+        // Двоичный метод слева направо: старший бит уже учтён в result
+        T result = a;
+        for (size_t i = bits - 1; i-- > 0;) {
+            result = mul(result, result);
+            if ((n >> i) & 1) {
+                result = mul(result, a);
+            }
+        }
+        return result;
+    }
+
+    // Нечётные степени: odd_powers[k] = a^(2k + 1)
+    const size_t table_size = size_t{1} << (width - 1);
+    std::vector<T> odd_powers;
+    odd_powers.reserve(table_size);
+    odd_powers.push_back(a);
+    const T a_squared = mul(a, a);
+    for (size_t k = 1; k < table_size; ++k) {
+        odd_powers.push_back(mul(odd_powers.back(), a_squared));
+    }
+
+    // Старший бит n равен 1, поэтому первое окно всегда инициализирует result
+    std::optional<T> result;
+    size_t remaining = bits; // Следующий обрабатываемый бит: remaining - 1
+    while (remaining > 0) {
+        if (((n >> (remaining - 1)) & 1) == 0) {
+            result = mul(*result, *result);
+            --remaining;
+            continue;
+        }
+
+        // Окно [low, remaining - 1] длины не более width, заканчивающееся единицей
+        size_t low = remaining > width ? remaining - width : 0;
+        while (((n >> low) & 1) == 0) {
+            ++low;
+        }
+        const size_t length = remaining - low;
+        const size_t window = (n >> low) & ((size_t{1} << length) - 1);
+
+        if (result.has_value()) {
+            for (size_t k = 0; k < length; ++k) {
+                result = mul(*result, *result);
+            }
+            result = mul(*result, odd_powers[window >> 1]);
+        } else {
+            result = odd_powers[window >> 1];
+        }
+        remaining = low;
+    }
+
+    return *result;
+}
+
+/**
+ * @brief Условный обмен без ветвления: при bit = true a и b меняются местами
+ *
+ * Байты представлений объектов обмениваются через маску 0x00 / 0xFF, поэтому
+ * ни переходы, ни адреса обращений к памяти не зависят от bit. Применимо только
+ * к тривиально копируемым T; для остальных типов см. conditional_swap.
+ */
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+void masked_swap(T& a, T& b, bool bit) noexcept {
+    unsigned char mask = static_cast<unsigned char>(0u - static_cast<unsigned>(bit));
+#if defined(__GNUC__)
+    // Не даём компилятору восстановить ветвление по bit из маски
+    __asm__("" : "+r"(mask));
+#endif
+    unsigned char bytes_a[sizeof(T)];
+    unsigned char bytes_b[sizeof(T)];
+    std::memcpy(bytes_a, &a, sizeof(T));
+    std::memcpy(bytes_b, &b, sizeof(T));
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        const unsigned char difference = (bytes_a[i] ^ bytes_b[i]) & mask;
+        bytes_a[i] ^= difference;
+        bytes_b[i] ^= difference;
+    }
+    std::memcpy(&a, bytes_a, sizeof(T));
+    std::memcpy(&b, bytes_b, sizeof(T));
+}
+
+/**
+ * @brief Условный обмен для лестницы Монтгомери
+ *
+ * Порядок выбора:
+ * 1. op.conditional_swap(a, b, bit), если операция его предоставляет - точка
+ *    расширения для типов с динамической памятью (большие числа, точки кривых);
+ * 2. masked_swap для тривиально копируемых T;
+ * 3. иначе std::swap под условием - ветвление по bit остаётся, и лестница
+ *    гарантирует только фиксированную последовательность групповых операций.
+ */
+template<typename Op, typename T>
+void conditional_swap(const Op& op, T& a, T& b, bool bit) {
+    if constexpr (requires { op.conditional_swap(a, b, bit); }) {
+        op.conditional_swap(a, b, bit);
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+        masked_swap(a, b, bit);
+    } else if (bit) {
+        std::swap(a, b);
+    }
+}
+
+/**
+ * @brief Лестница Монтгомери: a^n с фиксированной последовательностью операций
+ *
+ * Обрабатывает все биты size_t независимо от длины показателя и на каждом шаге
+ * выполняет ровно одно умножение и одно возведение в квадрат, поэтому число и
+ * порядок групповых операций не зависят от n. Выбор операндов по биту выполняется
+ * условным обменом cswap(r0, r1, bit) без ветвления (см. conditional_swap):
+ * обмен применяется только при смене бита, и в конце - по последнему биту.
+ * Время самой операции mul определяется типом T и не контролируется.
+ *
+ * @param cswap Вызывается как cswap(x, y, bit) и меняет x и y местами при bit = true
+ */
+template<typename T, typename Mul, typename CSwap>
+T montgomery_ladder_power(const T& identity, const T& a, size_t n, Mul mul, CSwap cswap) {
+    T r0 = identity;
+    T r1 = a;
+    bool previous = false;
+
+    for (size_t i = std::numeric_limits<size_t>::digits; i-- > 0;) {
+        const bool bit = ((n >> i) & 1) != 0;
+        // (r0, r1) → (r0², r0·r1) при bit = 0 или (r0·r1, r1²) при bit = 1
+        cswap(r0, r1, bit != previous);
+        previous = bit;
+        r1 = mul(r0, r1);
+        r0 = mul(r0, r0);
+    }
+    cswap(r0, r1, previous);
+
+    return r0;
+}
+
+/**
+ * @brief Ширина окна для метода Страуса в зависимости от длины показателей
+ */
+inline size_t straus_window_width(size_t exponent_bits) noexcept {
+    if (exponent_bits <= 4) {
+        return 1;
+    }
+    if (exponent_bits <= 16) {
+        return 2;
+    }
+    if (exponent_bits <= 48) {
+        return 3;
+    }
+    return 4;
+}
+
+/**
+ * @brief Ширина окна (число бит на корзину) для метода Пиппенджера
+ *
+ * Около log₂(m) - 2 бит для m слагаемых: число корзин 2^c растёт медленнее,
+ * чем сокращается число окон.
+ */
+inline size_t pippenger_window_width(size_t count) noexcept {
+    const size_t log_count = static_cast<size_t>(std::bit_width(count));
+    if (log_count <= 4) {
+        return 2;
+    }
+    return std::min<size_t>(log_count - 2, 16);
+}
+
+/**
+ * @brief Одновременное возведение в степень методом Страуса (трюк Шамира): ∏ gᵢ^eᵢ
+ *
+ * Для каждого основания строится таблица gᵢ^0, ..., gᵢ^(2^w - 1), после чего все
+ * показатели обрабатываются одним проходом по окнам из w бит: общие возведения
+ * в квадрат выполняются один раз для всех слагаемых. Подходит для небольшого
+ * числа оснований.
+ *
+ * Предусловие: основания попарно перестановочны, bases.size() == exponents.size().
+ */
+template<typename T, typename Mul>
+T straus_multi_power(const T& identity, const std::vector<T>& bases,
+                     const std::vector<size_t>& exponents, Mul mul) {
+    size_t max_exponent = 0;
+    for (size_t e : exponents) {
+        max_exponent = std::max(max_exponent, e);
+    }
+    const size_t bits = static_cast<size_t>(std::bit_width(max_exponent));
+    if (bits == 0) {
+        return identity;
+    }
+
+    const size_t width = straus_window_width(bits);
+    const size_t digits = (bits + width - 1) / width;
+    const size_t table_size = size_t{1} << width;
+    const size_t digit_mask = table_size - 1;
+
+    // tables[i * table_size + d] = gᵢ^d при d ≥ 1
+    std::vector<T> tables;
+    tables.reserve(bases.size() * table_size);
+    for (const auto& base : bases) {
+        tables.push_back(identity);
+        tables.push_back(base);
+        for (size_t d = 2; d < table_size; ++d) {
+            tables.push_back(mul(tables.back(), base));
+        }
+    }
+
+    std::optional<T> result;
+    for (size_t position = digits; position-- > 0;) {
+        if (result.has_value()) {
+            for (size_t k = 0; k < width; ++k) {
+                result = mul(*result, *result);
+            }
+        }
+        for (size_t i = 0; i < bases.size(); ++i) {
+            const size_t digit = (exponents[i] >> (position * width)) & digit_mask;
+            if (digit != 0) {
+                const T& factor = tables[i * table_size + digit];
+                result = result.has_value() ? mul(*result, factor) : factor;
+            }
+        }
+    }
+
+    return result.has_value() ? *result : identity;
+}
+
+/**
+ * @brief Одновременное возведение в степень методом корзин Пиппенджера: ∏ gᵢ^eᵢ
+ *
+ * Показатели делятся на окна из c бит. В каждом окне основания раскладываются по
+ * 2^c - 1 корзинам согласно цифре показателя, а ∏ B_d^d вычисляется накоплением
+ * частичных произведений корзин от старшей к младшей, то есть за 2·2^c операций
+ * независимо от числа оснований. Для m оснований общий объём работы примерно в
+ * log m раз меньше, чем у m независимых возведений в степень.
+ *
+ * Предусловие: основания попарно перестановочны, bases.size() == exponents.size().
+ */
+template<typename T, typename Mul>
+T pippenger_multi_power(const T& identity, const std::vector<T>& bases,
+                        const std::vector<size_t>& exponents, Mul mul) {
+    size_t max_exponent = 0;
+    for (size_t e : exponents) {
+        max_exponent = std::max(max_exponent, e);
+    }
+    const size_t bits = static_cast<size_t>(std::bit_width(max_exponent));
+    if (bits == 0) {
+        return identity;
+    }
+
+    const size_t width = pippenger_window_width(bases.size());
+    const size_t windows = (bits + width - 1) / width;
+    const size_t digit_mask = (size_t{1} << width) - 1;
+
+    std::optional<T> result;
+    std::vector<std::optional<T>> buckets(digit_mask);
+    for (size_t window = windows; window-- > 0;) {
+        if (result.has_value()) {
+            for (size_t k = 0; k < width; ++k) {
+                result = mul(*result, *result);
+            }
+        }
+
+        // Раскладываем основания по корзинам: buckets[d - 1] = ∏ gᵢ с цифрой d
+        for (auto& bucket : buckets) {
+            bucket.reset();
+        }
+        for (size_t i = 0; i < bases.size(); ++i) {
+            const size_t digit = (exponents[i] >> (window * width)) & digit_mask;
+            if (digit != 0) {
+                auto& bucket = buckets[digit - 1];
+                bucket = bucket.has_value() ? mul(*bucket, bases[i]) : bases[i];
+            }
+        }
+
+        // ∏ B_d^d = ∏_k (∏_{d ≥ k} B_d): накопление суффиксных произведений
+        std::optional<T> running;
+        std::optional<T> window_sum;
+        for (size_t d = digit_mask; d > 0; --d) {
+            if (buckets[d - 1].has_value()) {
+                running = running.has_value() ? mul(*running, *buckets[d - 1]) : *buckets[d - 1];
+            }
+            if (running.has_value()) {
+                window_sum = window_sum.has_value() ? mul(*window_sum, *running) : *running;
+            }
+        }
+
+        if (window_sum.has_value()) {
+            result = result.has_value() ? mul(*result, *window_sum) : *window_sum;
+        }
+    }
+
+    return result.has_value() ? *result : identity;
+}
+
+} // namespace detail
+
+} // namespace cryptomath
@@ -4,9 +4,12 @@
 #include "group.hpp"
 #include "set.hpp"
 #include "coset.hpp"
+#include "homomorphism.hpp"
 #include <concepts>
-#include <map>
-#include <functional>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <vector>
 
 namespace cryptomath {
 
@@ -20,9 +23,17 @@ namespace cryptomath {
  * Эта операция корректно определена, потому что N нормальна.
  * 
  * Фактор-группа G/N имеет:
- * - Элементы: смежные классы N (которые являются множествами)
+ * - Элементы: смежные классы N
  * - Операцию: (g1 ∘ N) * (g2 ∘ N) = (g1 ∘ g2) ∘ N
  * - Единицу: N (смежный класс, содержащий единицу)
+ * 
+ * Хранится только таблица CosetTable: номер класса для каждого элемента G и
+ * представители классов. operate, identity и inverse находят номер результата
+ * по таблице и строят класс-множество по его представителю; coset_of и
+ * cosets() выдают классы как представления Coset, разделяющие разметку с
+ * таблицей. Множество классов get_cosets() строится при первом обращении;
+ * одновременные обращения из разных потоков должны синхронизироваться
+ * вызывающим кодом.
  */
 template<typename T, typename Op>
     requires GroupConcept<T, Op>
@@ -30,28 +41,79 @@ class FactorGroup {
 public:
     using group_type = Group<T, Op>;
     using normal_subgroup_type = NormalSubgroup<T, Op>;
-    using element_type = Set<T>; // Смежные классы являются множествами
+    using element_type = Set<T>; // Смежные классы как множества (get_cosets, coset_operation)
     using set_type = Set<Set<T>>;
-    using operation_type = std::function<Set<T>(const Set<T>&, const Set<T>&)>;
+
+    /**
+     * @brief Операция фактор-группы как функциональный объект
+     * 
+     * Хранит ссылки на группу G и нормальную подгруппу N, а не на фактор-группу,
+     * поэтому остаётся корректной после копирования, перемещения или уничтожения
+     * FactorGroup (например, в CayleyTable, построенной по временному объекту);
+     * G и N должны пережить операцию. Произведение классов (a ∘ N) * (b ∘ N)
+     * строится как (a ∘ b) ∘ N по представителям - первым элементам классов.
+     * Аргументы не проверяются: это должны быть смежные классы N.
+     */
+    class coset_operation {
+    public:
+        coset_operation(const group_type& group, const normal_subgroup_type& normal_subgroup) noexcept
+            : group_(&group), normal_subgroup_(&normal_subgroup) {}
+
+        Set<T> operator()(const Set<T>& coset_a, const Set<T>& coset_b) const {
+            if (coset_a.empty() || coset_b.empty()) {
+                throw std::domain_error("Invalid cosets");
+            }
+            const T product = group_->operate_unchecked(*coset_a.begin(), *coset_b.begin());
+            std::vector<T> values;
+            values.reserve(normal_subgroup_->size());
+            for (const auto& n : normal_subgroup_->get_subset()) {
+                values.push_back(group_->operate_unchecked(product, n));
+            }
+            return Set<T>(values.begin(), values.end());
+        }
+
+    private:
+        // Указатели, а не ссылки, чтобы операция оставалась присваиваемой
+        const group_type* group_;
+        const normal_subgroup_type* normal_subgroup_;
+    };
+
+    using operation_type = coset_operation;
+    using coset_type = Coset<T, Op>;
 
     /**
      * @brief Построить фактор-группу из группы и нормальной подгруппы
      */
     FactorGroup(const group_type& group, const normal_subgroup_type& normal_subgroup)
-        : parent_group_(group), normal_subgroup_(normal_subgroup) {
-        
-        // Строим множество смежных классов
-        build_coset_set();
-        
-        // Строим операцию
-        build_operation();
-    }
+        : parent_group_(group), normal_subgroup_(normal_subgroup), table_(group, normal_subgroup) {}
 
     /**
      * @brief Получить множество смежных классов (элементов фактор-группы)
+     * 
+     * Множество строится при первом обращении и кэшируется.
      */
-    const set_type& get_cosets() const noexcept {
-        return cosets_;
+    const set_type& get_cosets() const {
+        if (!cosets_.has_value()) {
+            const auto sets = table_.coset_sets();
+            cosets_ = set_type(sets.begin(), sets.end());
+        }
+        return *cosets_;
+    }
+
+    /**
+     * @brief Все смежные классы как представления, по номерам таблицы
+     */
+    std::vector<coset_type> cosets() const {
+        return table_.cosets();
+    }
+
+    /**
+     * @brief Смежный класс g ∘ N
+     * 
+     * @throws std::domain_error если элемент не принадлежит группе
+     */
+    coset_type coset_of(const T& g) const {
+        return table_.coset(table_.label_of(g));
     }
 
     /**
@@ -69,86 +131,77 @@ public:
     }
 
     /**
-     * @brief Применить операцию фактор-группы: (aN) * (bN) = (ab)N
+     * @brief Получить таблицу смежных классов N
      */
-    Set<T> operate(const Set<T>& coset_a, const Set<T>& coset_b) const {
-        // Проверяем, что смежные классы валидны
-        if (!cosets_.contains(coset_a) || !cosets_.contains(coset_b)) {
-            throw std::domain_error("Invalid cosets");
-        }
-
-        // Выбираем представителей из каждого смежного класса
-        T rep_a = *coset_a.begin();
-        T rep_b = *coset_b.begin();
+    const CosetTable<T, Op>& coset_table() const noexcept {
+        return table_;
+    }
 
-        // Вычисляем произведение в родительской группе
-        T product = parent_group_.operate(rep_a, rep_b);
+    /**
+     * @brief Получить операцию фактор-группы
+     */
+    operation_type get_operation() const noexcept {
+        return operation_type(parent_group_, normal_subgroup_);
+    }
 
-        // Находим смежный класс, содержащий произведение
-        return find_coset_containing(product);
+    /**
+     * @brief Применить операцию фактор-группы: (aN) * (bN) = (ab)N
+     * 
+     * Номер класса произведения представителей берётся из таблицы.
+     * 
+     * @throws std::domain_error если аргументы не являются смежными классами N
+     */
+    Set<T> operate(const Set<T>& coset_a, const Set<T>& coset_b) const {
+        return coset_set(product_label(label_of(coset_a), label_of(coset_b)));
     }
 
     /**
      * @brief Получить единичный элемент (смежный класс, содержащий единицу)
      */
     Set<T> identity() const {
-        return find_coset_containing(parent_group_.identity());
+        return coset_set(table_.label_of(parent_group_.identity()));
     }
 
     /**
      * @brief Получить обратный элемент смежного класса
+     * 
+     * @throws std::domain_error если аргумент не является смежным классом N
      */
     Set<T> inverse(const Set<T>& coset) const {
-        if (!cosets_.contains(coset)) {
-            throw std::domain_error("Invalid coset");
-        }
-
-        // Выбираем представителя
-        T rep = *coset.begin();
-        T rep_inverse = parent_group_.inverse(rep);
-
-        // Возвращаем смежный класс, содержащий обратный элемент
-        return find_coset_containing(rep_inverse);
+        return coset_set(inverse_label(label_of(coset)));
     }
 
     /**
      * @brief Получить размер фактор-группы (индекс нормальной подгруппы)
      */
     size_t size() const noexcept {
-        return cosets_.size();
+        return table_.index();
     }
 
     /**
      * @brief Проверить свойства фактор-группы
+     * 
+     * Единица, обратные и ассоциативность проверяются на номерах классов.
      */
     bool verify_factor_group() const {
-        // Проверяем единицу
-        Set<T> identity_coset = identity();
-        for (const auto& coset : cosets_) {
-            Set<T> left = operate(identity_coset, coset);
-            Set<T> right = operate(coset, identity_coset);
-            if (left != coset || right != coset) {
+        const size_t count = size();
+        const size_t e = table_.labels()[parent_group_.index_of(parent_group_.identity())];
+
+        for (size_t a = 0; a < count; ++a) {
+            if (product_label(e, a) != a || product_label(a, e) != a) {
                 return false;
             }
-        }
-
-        // Проверяем обратные элементы
-        for (const auto& coset : cosets_) {
-            Set<T> inv = inverse(coset);
-            Set<T> left = operate(coset, inv);
-            Set<T> right = operate(inv, coset);
-            if (left != identity_coset || right != identity_coset) {
+            const size_t a_inverse = inverse_label(a);
+            if (product_label(a, a_inverse) != e || product_label(a_inverse, a) != e) {
                 return false;
             }
         }
 
-        // Проверяем ассоциативность
-        for (const auto& a : cosets_) {
-            for (const auto& b : cosets_) {
-                for (const auto& c : cosets_) {
-                    Set<T> left = operate(operate(a, b), c);
-                    Set<T> right = operate(a, operate(b, c));
-                    if (left != right) {
+        for (size_t a = 0; a < count; ++a) {
+            for (size_t b = 0; b < count; ++b) {
+                const size_t ab = product_label(a, b);
+                for (size_t c = 0; c < count; ++c) {
+                    if (product_label(ab, c) != product_label(a, product_label(b, c))) {
                         return false;
                     }
                 }
@@ -167,38 +220,49 @@ public:
     }
 
 private:
-    void build_coset_set() {
-        // Получаем все левые смежные классы (так как N нормальна, левые = правые)
-        cosets_ = LagrangesTheorem<T, Op>::find_all_cosets(
-            parent_group_,
-            normal_subgroup_
-        );
-
-        // Строим отображение из элемента в его смежный класс
-        for (const auto& coset : cosets_) {
-            for (const auto& element : coset) {
-                element_to_coset_[element] = coset;
+    /**
+     * @brief Номер смежного класса N в таблице
+     * 
+     * Множество - класс N, если в нём |N| элементов группы с одним номером.
+     */
+    size_t label_of(const Set<T>& coset) const {
+        if (coset.size() != normal_subgroup_.size()) {
+            throw std::domain_error("Invalid coset");
+        }
+        const std::vector<size_t>& labels = table_.labels();
+        std::optional<size_t> label;
+        for (const auto& x : coset) {
+            auto index = parent_group_.find_index(x);
+            if (!index.has_value() || (label.has_value() && labels[*index] != *label)) {
+                throw std::domain_error("Invalid coset");
             }
+            label = labels[*index];
         }
+        return *label;
     }
 
-    void build_operation() {
-        // Операция строится в методе operate()
-        // Это заглушка для будущей оптимизации
+    /**
+     * @brief Класс c как множество: представитель, умноженный на элементы N
+     */
+    Set<T> coset_set(size_t c) const {
+        const coset_type coset = table_.coset(c);
+        std::vector<T> values(coset.begin(), coset.end());
+        return Set<T>(values.begin(), values.end());
     }
 
-    Set<T> find_coset_containing(const T& element) const {
-        auto it = element_to_coset_.find(element);
-        if (it != element_to_coset_.end()) {
-            return it->second;
-        }
-        throw std::logic_error("Element not found in any coset");
+    size_t product_label(size_t a, size_t b) const {
+        const std::vector<size_t>& representatives = table_.representative_indices();
+        return table_.labels()[parent_group_.operate_indices(representatives[a], representatives[b])];
+    }
+
+    size_t inverse_label(size_t a) const {
+        return table_.labels()[parent_group_.inverse_index(table_.representative_indices()[a])];
     }
 
     const group_type& parent_group_;
     const normal_subgroup_type& normal_subgroup_;
-    set_type cosets_;
-    std::map<T, Set<T>> element_to_coset_;
+    CosetTable<T, Op> table_;
+    mutable std::optional<set_type> cosets_; // Лениво построенное множество классов
 };
 
 /**
@@ -226,6 +290,17 @@ public:
         // Заглушка для будущей реализации
         return factor_group.size() == image.size();
     }
+
+    /**
+     * @brief Проверить теорему для гомоморфизма φ: G → H
+     * 
+     * См. GroupHomomorphism::verify_first_isomorphism: проверяется, что все
+     * непустые слои φ являются смежными классами ker φ.
+     */
+    template<typename U, typename OpU>
+    static bool verify(const GroupHomomorphism<T, Op, U, OpU>& phi) {
+        return phi.verify_first_isomorphism();
+    }
 };
 
 } // namespace cryptomath
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "monoid.hpp"
+#include "concepts.hpp"
+#include <bit>
+#include <concepts>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Возведение фиксированного основания в степень гребенчатым методом (Лим–Ли)
+ *
+ * Для основания g и показателей длиной не более L бит показатель делится на h
+ * «зубцов» по d = ⌈L / h⌉ бит. Таблица из 2^h элементов
+ *   T[v] = ∏ g^(2^(j·d)) по всем битам j числа v
+ * строится один раз, после чего g^n вычисляется за d возведений в квадрат и не
+ * более d умножений вместо L квадратов и около L / 2 умножений у двоичного метода.
+ *
+ * Выгодно, когда одно и то же основание возводится в степень многократно:
+ * порождающий элемент циклической группы, перебор при дискретном логарифмировании.
+ */
+template<typename T, typename Op>
+    requires MonoidConcept<T, Op>
+class FixedBasePower {
+public:
+    using monoid_type = Monoid<T, Op>;
+    using element_type = T;
+
+    /**
+     * @brief Построить таблицу для основания base и показателей до max_exponent
+     *
+     * Показатели больше max_exponent вычисляются обычным Monoid::power.
+     *
+     * @throws std::domain_error если основание не принадлежит моноиду
+     */
+    FixedBasePower(const monoid_type& monoid, const T& base, size_t max_exponent)
+        : monoid_(monoid), base_(base),
+          max_bits_(static_cast<size_t>(std::bit_width(max_exponent))) {
+        if (!monoid_.get_set().contains(base_)) {
+            throw std::domain_error("Base not in monoid");
+        }
+
+        teeth_ = choose_teeth(max_bits_);
+        spacing_ = max_bits_ == 0 ? 0 : (max_bits_ + teeth_ - 1) / teeth_;
+        build_table();
+    }
+
+    /**
+     * @brief Вычислить base^n
+     */
+    T power(size_t n) const {
+        if (static_cast<size_t>(std::bit_width(n)) > max_bits_) {
+            return monoid_.power(base_, n);
+        }
+
+        T result = monoid_.identity();
+        bool started = false;
+        for (size_t i = spacing_; i-- > 0;) {
+            if (started) {
+                result = monoid_.operate_unchecked(result, result);
+            }
+
+            size_t v = 0;
+            for (size_t j = 0; j < teeth_; ++j) {
+                const size_t bit = i + j * spacing_;
+                if (bit < max_bits_ && ((n >> bit) & 1)) {
+                    v |= size_t{1} << j;
+                }
+            }
+
+            if (v != 0) {
+                result = started ? monoid_.operate_unchecked(result, table_[v]) : table_[v];
+                started = true;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Вычислить base^n (в форме оператора)
+     */
+    T operator()(size_t n) const {
+        return power(n);
+    }
+
+    /**
+     * @brief Получить основание
+     */
+    const T& base() const noexcept {
+        return base_;
+    }
+
+    /**
+     * @brief Получить число элементов предвычисленной таблицы (2^h)
+     */
+    size_t table_size() const noexcept {
+        return table_.size();
+    }
+
+private:
+    // Число зубцов h: таблица 2^h растёт быстрее, чем убывает d = ⌈L / h⌉
+    static size_t choose_teeth(size_t bits) noexcept {
+        if (bits <= 8) {
+            return 2;
+        }
+        if (bits <= 16) {
+            return 3;
+        }
+        if (bits <= 32) {
+            return 4;
+        }
+        if (bits <= 48) {
+            return 5;
+        }
+        return 6;
+    }
+
+    void build_table() {
+        // g_j = base^(2^(j·d)) для j = 0, ..., h - 1
+        std::vector<T> tooth_bases;
+        tooth_bases.reserve(teeth_);
+        tooth_bases.push_back(base_);
+        for (size_t j = 1; j < teeth_; ++j) {
+            T next = tooth_bases.back();
+            for (size_t k = 0; k < spacing_; ++k) {
+                next = monoid_.operate_unchecked(next, next);
+            }
+            tooth_bases.push_back(next);
+        }
+
+        // T[v] = T[v без младшего бита] ∘ g_(младший бит)
+        const size_t size = size_t{1} << teeth_;
+        table_.reserve(size);
+        table_.push_back(monoid_.identity());
+        for (size_t v = 1; v < size; ++v) {
+            const size_t low = static_cast<size_t>(std::countr_zero(v));
+            table_.push_back(monoid_.operate_unchecked(table_[v & (v - 1)], tooth_bases[low]));
+        }
+    }
+
+    const monoid_type& monoid_;
+    T base_;
+    size_t max_bits_;
+    size_t teeth_ = 1;
+    size_t spacing_ = 0;
+    std::vector<T> table_;
+};
+
+} // namespace cryptomath
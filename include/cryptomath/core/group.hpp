@@ -3,11 +3,58 @@
 #include "monoid.hpp"
 #include "concepts.hpp"
 #include <concepts>
-#include <map>
+#include <optional>
+#include <vector>
+#include <type_traits>
 #include <stdexcept>
 
 namespace cryptomath {
 
+namespace detail {
+
+/**
+ * @brief Добавить порождающий к подгруппе (алгоритм Димино)
+ *
+ * closure - элементы подгруппы H = ⟨generators без последнего⟩ (in_closure - их
+ * отметки по индексам группы), generators.back() - новый порождающий g.
+ * Новая подгруппа ⟨H, g⟩ строится правыми смежными классами H ∘ r: первый
+ * представитель - g, а каждый представитель, умноженный справа на каждый
+ * порождающий, либо попадает в уже добавленный класс, либо открывает новый.
+ * Элементы класса добавляются целиком как h ∘ r, поэтому на класс приходится
+ * |H| умножений и |generators| проверок: O(|⟨H, g⟩| + [⟨H, g⟩ : H] · |generators|).
+ */
+template<typename GroupType>
+void extend_closure(const GroupType& group, std::vector<bool>& in_closure,
+                    std::vector<size_t>& closure, const std::vector<size_t>& generators) {
+    const size_t g = generators.back();
+    if (in_closure[g]) {
+        return;
+    }
+
+    const size_t subgroup_size = closure.size();
+    auto add_coset = [&](size_t representative) {
+        for (size_t k = 0; k < subgroup_size; ++k) {
+            const size_t element = group.operate_indices(closure[k], representative);
+            in_closure[element] = true;
+            closure.push_back(element);
+        }
+    };
+
+    std::vector<size_t> representatives{g};
+    add_coset(g);
+    for (size_t head = 0; head < representatives.size(); ++head) {
+        for (size_t s : generators) {
+            const size_t next = group.operate_indices(representatives[head], s);
+            if (!in_closure[next]) {
+                representatives.push_back(next);
+                add_coset(next);
+            }
+        }
+    }
+}
+
+} // namespace detail
+
 /**
  * @brief Группа: моноид, где каждый элемент имеет обратный
  * 
@@ -22,6 +69,10 @@ namespace cryptomath {
  * - Обратный элемент каждого элемента единственен
  * - (a⁻¹)⁻¹ = a
  * - (a ∘ b)⁻¹ = b⁻¹ ∘ a⁻¹
+ * 
+ * Порождающие и центр вычисляются при первом обращении и сохраняются в объекте,
+ * поэтому константные методы не потокобезопасны: при доступе к одной группе из
+ * нескольких потоков вызовы нужно синхронизировать.
  */
 template<typename T, typename Op>
     requires GroupConcept<T, Op>
@@ -35,14 +86,23 @@ public:
     /**
      * @brief Построить группу из множества, ассоциативной операции, единицы и функции обратного элемента
      * 
+     * Функция обратного элемента передаётся как параметр шаблона и вызывается
+     * только при построении: все обратные сразу записываются в таблицу, поэтому
+     * объект группы не хранит её и не платит за косвенный вызов.
+     * 
      * @throws std::invalid_argument если свойства группы не выполнены
      */
+    template<typename InverseFunc>
+        requires std::regular_invocable<const InverseFunc&, const T&> &&
+                 std::convertible_to<std::invoke_result_t<const InverseFunc&, const T&>, T>
     Group(const set_type& elements, Op op, const T& identity,
-          std::function<T(const T&)> inverse_func)
-        : base_type(elements, op, identity), inverse_func_(inverse_func) {
+          InverseFunc inverse_func)
+        : base_type(elements, op, identity) {
+        inverse_table_.reserve(this->indexed_elements_.size());
+
         // Проверяем, что каждый элемент имеет обратный
         for (const auto& a : this->elements_) {
-            T inv_a = inverse_func_(a);
+            T inv_a = inverse_func(a);
             
             // Проверяем, что обратный элемент в множестве
             if (!this->elements_.contains(inv_a)) {
@@ -52,21 +112,19 @@ public:
             }
 
             // Проверяем свойство обратного элемента
-            if (this->operate(a, inv_a) != this->identity()) {
+            if (this->operate_unchecked(a, inv_a) != this->identity()) {
                 throw std::invalid_argument(
                     "Inverse does not satisfy a ∘ a⁻¹ = e"
                 );
             }
-            if (this->operate(inv_a, a) != this->identity()) {
+            if (this->operate_unchecked(inv_a, a) != this->identity()) {
                 throw std::invalid_argument(
                     "Inverse does not satisfy a⁻¹ ∘ a = e"
                 );
             }
-        }
 
-        // Строим карту обратных элементов для эффективного поиска
-        for (const auto& a : this->elements_) {
-            inverse_map_[a] = inverse_func_(a);
+            // Запоминаем индекс обратного элемента (элементы обходятся в порядке индексов)
+            inverse_table_.push_back(this->index_of(inv_a));
         }
     }
 
@@ -77,17 +135,24 @@ public:
      */
     explicit Group(const Monoid<T, Op>& monoid)
         : base_type(monoid) {
-        // Проверяем, что все элементы обратимы
-        set_type invertible = this->invertible_elements();
-        if (invertible != this->get_set()) {
-            throw std::logic_error(
-                "Not all elements are invertible; monoid is not a group"
-            );
-        }
-
-        // Строим карту обратных элементов
-        for (const auto& a : this->elements_) {
-            inverse_map_[a] = this->Monoid<T, Op>::inverse(a);
+        // Ищем обратный для каждого элемента за один проход по строке таблицы Кэли
+        const auto& elements = this->indexed_elements_;
+        inverse_table_.reserve(elements.size());
+        for (const auto& a : elements) {
+            bool found = false;
+            for (size_t j = 0; j < elements.size(); ++j) {
+                if (this->operate_unchecked(a, elements[j]) == this->identity() &&
+                    this->operate_unchecked(elements[j], a) == this->identity()) {
+                    inverse_table_.push_back(j);
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                throw std::logic_error(
+                    "Not all elements are invertible; monoid is not a group"
+                );
+            }
         }
     }
 
@@ -97,66 +162,223 @@ public:
      * Обратный элемент единственен (доказано математически).
      */
     T inverse(const T& a) const {
-        if (!this->elements_.contains(a)) {
+        auto index = this->find_index(a);
+        if (!index.has_value()) {
             throw std::domain_error("Element not in group");
         }
-        auto it = inverse_map_.find(a);
-        if (it != inverse_map_.end()) {
-            return it->second;
+        return this->indexed_elements_[inverse_table_[*index]];
+    }
+
+    /**
+     * @brief Получить индекс обратного элемента по индексу элемента
+     * 
+     * Таблица заполняется один раз в конструкторе, поэтому это O(1).
+     */
+    size_t inverse_index(size_t index) const noexcept {
+        return inverse_table_[index];
+    }
+
+    /**
+     * @brief Произведение элементов по индексам: индекс element_at(i) ∘ element_at(j)
+     */
+    size_t operate_indices(size_t i, size_t j) const {
+        return this->index_of(this->operate_unchecked(this->indexed_elements_[i], this->indexed_elements_[j]));
+    }
+
+    /**
+     * @brief Индексы порождающего множества группы
+     * 
+     * Строится один раз жадно: элементы перебираются в порядке индексов, и
+     * элемент, не лежащий в подгруппе, порождённой уже выбранными, добавляется
+     * в список, после чего подгруппа замыкается. Каждое добавление как минимум
+     * удваивает подгруппу, поэтому порождающих не больше log₂ |G|.
+     */
+    const std::vector<size_t>& generator_indices() const {
+        if (!generators_.has_value()) {
+            const size_t n = this->indexed_elements_.size();
+            std::vector<size_t> generators;
+            std::vector<bool> in_subgroup(n, false);
+            std::vector<size_t> subgroup{this->index_of(this->identity())};
+            in_subgroup[subgroup.front()] = true;
+
+            for (size_t candidate = 0; candidate < n && subgroup.size() < n; ++candidate) {
+                if (in_subgroup[candidate]) {
+                    continue;
+                }
+                generators.push_back(candidate);
+                detail::extend_closure(*this, in_subgroup, subgroup, generators);
+            }
+            generators_ = std::move(generators);
+        }
+        return *generators_;
+    }
+
+    /**
+     * @brief Порождающее множество группы (см. generator_indices)
+     */
+    std::vector<T> generators() const {
+        std::vector<T> result;
+        for (size_t i : generator_indices()) {
+            result.push_back(this->indexed_elements_[i]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Центр группы Z(G)
+     * 
+     * Элемент перестановочен со всеми элементами тогда и только тогда, когда он
+     * перестановочен с порождающими, поэтому Z(G) - пересечение централизаторов
+     * порождающих: O(|G| · |порождающих|) операций. Результат кэшируется.
+     */
+    const set_type& center() const {
+        if (!center_.has_value()) {
+            const auto& elements = this->indexed_elements_;
+            const std::vector<size_t>& generators = generator_indices();
+            std::vector<T> central;
+            for (size_t i = 0; i < elements.size(); ++i) {
+                bool commutes = true;
+                for (size_t s : generators) {
+                    if (this->operate_unchecked(elements[i], elements[s]) !=
+                        this->operate_unchecked(elements[s], elements[i])) {
+                        commutes = false;
+                        break;
+                    }
+                }
+                if (commutes) {
+                    central.push_back(elements[i]);
+                }
+            }
+            center_ = set_type(central.begin(), central.end());
         }
-        // Запасной вариант (не должно произойти, если inverse_map_ построен правильно)
-        return inverse_func_(a);
+        return *center_;
     }
 
     /**
      * @brief Операция деления: a / b = a ∘ b⁻¹
      */
     T divide(const T& a, const T& b) const {
-        return this->operate(a, inverse(b));
+        T b_inverse = inverse(b);
+        if (!this->elements_.contains(a)) {
+            throw std::domain_error("Element not in group");
+        }
+        return this->operate_unchecked(a, b_inverse);
     }
 
     /**
      * @brief Левое деление: b \ a = b⁻¹ ∘ a
      */
     T left_divide(const T& a, const T& b) const {
-        return this->operate(inverse(b), a);
+        T b_inverse = inverse(b);
+        if (!this->elements_.contains(a)) {
+            throw std::domain_error("Element not in group");
+        }
+        return this->operate_unchecked(b_inverse, a);
     }
 
     /**
      * @brief Вычислить степень элемента: a^n
      * 
-     * Для группы определены отрицательные степени: a^(-n) = (a⁻¹)^n
+     * Для группы определены отрицательные степени: a^(-n) = (a⁻¹)^n.
+     * Использует возведение скользящим окном.
      */
     T power(const T& a, long long n) const {
+        if (!this->elements_.contains(a)) {
+            throw std::domain_error("Element not in group");
+        }
+
         if (n == 0) {
             return this->identity();
         }
 
-        if (n < 0) {
-            return power(inverse(a), -n);
+        const T base = n < 0 ? inverse(a) : a;
+
+        return detail::sliding_window_power(base, magnitude(n), [this](const T& x, const T& y) {
+            return this->operate_unchecked(x, y);
+        });
+    }
+
+    /**
+     * @brief Вычислить a^n лестницей Монтгомери (для секретных показателей)
+     * 
+     * Последовательность групповых операций не зависит от значения n, операнды
+     * выбираются условным обменом без ветвления (см. Monoid::power_ladder).
+     */
+    T power_ladder(const T& a, long long n) const {
+        if (!this->elements_.contains(a)) {
+            throw std::domain_error("Element not in group");
         }
 
-        // Используем бинарное возведение в степень для положительных степеней
-        T result = this->identity();
-        T current_power = a;
-        size_t exp = static_cast<size_t>(n);
+        const T base = n < 0 ? inverse(a) : a;
+        return detail::montgomery_ladder_power(this->identity(), base, magnitude(n),
+            [this](const T& x, const T& y) {
+                return this->operate_unchecked(x, y);
+            },
+            [this](T& x, T& y, bool bit) {
+                detail::conditional_swap(this->operation_, x, y, bit);
+            });
+    }
 
-        while (exp > 0) {
-            if (exp % 2 == 1) {
-                result = this->operate(result, current_power);
+    /**
+     * @brief Одновременное возведение в степень: ∏ gᵢ^eᵢ
+     * 
+     * Для небольшого числа оснований используется метод Страуса/Шамира, для
+     * больших наборов - метод корзин Пиппенджера (см. exponentiation.hpp).
+     * Отрицательные показатели обрабатываются через обратные элементы.
+     * 
+     * Предусловие: группа абелева (или основания попарно перестановочны).
+     * Для неабелевых групп используйте product от отдельных степеней.
+     * 
+     * @throws std::invalid_argument если числа оснований и показателей различаются
+     * @throws std::domain_error если основание не принадлежит группе
+     */
+    T multi_power(const std::vector<T>& bases, const std::vector<long long>& exponents) const {
+        if (bases.size() != exponents.size()) {
+            throw std::invalid_argument("Number of bases and exponents must match");
+        }
+
+        std::vector<T> normalized_bases;
+        std::vector<size_t> magnitudes;
+        normalized_bases.reserve(bases.size());
+        magnitudes.reserve(bases.size());
+        for (size_t i = 0; i < bases.size(); ++i) {
+            if (exponents[i] < 0) {
+                normalized_bases.push_back(inverse(bases[i]));
+            } else {
+                if (!this->elements_.contains(bases[i])) {
+                    throw std::domain_error("Element not in group");
+                }
+                normalized_bases.push_back(bases[i]);
             }
-            current_power = this->operate(current_power, current_power);
-            exp /= 2;
+            magnitudes.push_back(magnitude(exponents[i]));
         }
 
-        return result;
+        auto mul = [this](const T& x, const T& y) {
+            return this->operate_unchecked(x, y);
+        };
+        if (normalized_bases.size() < multi_power_pippenger_threshold) {
+            return detail::straus_multi_power(this->identity(), normalized_bases, magnitudes, mul);
+        }
+        return detail::pippenger_multi_power(this->identity(), normalized_bases, magnitudes, mul);
     }
 
     /**
      * @brief Проверить, является ли группа абелевой (коммутативной)
      */
     bool is_abelian() const {
-        return this->is_commutative();
+        // Группа абелева тогда и только тогда, когда перестановочны её порождающие
+        const auto& elements = this->indexed_elements_;
+        const std::vector<size_t>& generators = generator_indices();
+        for (size_t i = 0; i < generators.size(); ++i) {
+            for (size_t j = i + 1; j < generators.size(); ++j) {
+                const T& a = elements[generators[i]];
+                const T& b = elements[generators[j]];
+                if (this->operate_unchecked(a, b) != this->operate_unchecked(b, a)) {
+                    return false;
+                }
+            }
+        }
+        return true;
     }
 
     /**
@@ -280,8 +502,17 @@ public:
     }
 
 private:
-    std::function<T(const T&)> inverse_func_;
-    std::map<T, T> inverse_map_; // Кэш для эффективного поиска обратных элементов
+    // Начиная с этого числа оснований метод корзин выгоднее метода Страуса
+    static constexpr size_t multi_power_pippenger_threshold = 32;
+
+    // |n| без переполнения для n = LLONG_MIN
+    static size_t magnitude(long long n) noexcept {
+        return n < 0 ? static_cast<size_t>(-(n + 1)) + 1 : static_cast<size_t>(n);
+    }
+
+    std::vector<size_t> inverse_table_; // inverse_table_[i] - индекс обратного к i-му элементу
+    mutable std::optional<std::vector<size_t>> generators_; // Лениво выбранные порождающие
+    mutable std::optional<set_type> center_;                // Лениво вычисленный центр
 };
 
 /**
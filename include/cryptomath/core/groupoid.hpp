@@ -5,6 +5,21 @@
 #include <functional>
 #include <stdexcept>
 #include <concepts>
+#include <vector>
+#include <optional>
+#include <algorithm>
+
+/**
+ * @brief Проверка операций на границе публичного API
+ * 
+ * При CRYPTOMATH_CHECKED_OPERATIONS = 1 (по умолчанию) Groupoid::operate проверяет,
+ * что аргументы и результат принадлежат множеству. При значении 0 эти проверки
+ * отключаются. Алгоритмы библиотеки в любом случае проверяют входные данные один раз
+ * и затем используют operate_unchecked.
+ */
+#ifndef CRYPTOMATH_CHECKED_OPERATIONS
+#define CRYPTOMATH_CHECKED_OPERATIONS 1
+#endif
 
 namespace cryptomath {
 
@@ -29,7 +44,8 @@ public:
      * @brief Построить группоид из множества и операции
      */
     Groupoid(const set_type& elements, Op op)
-        : elements_(elements), operation_(op) {
+        : elements_(elements), operation_(op),
+          indexed_elements_(elements.begin(), elements.end()) {
         // Проверяем свойство замкнутости для всех пар
         for (const auto& a : elements_) {
             for (const auto& b : elements_) {
@@ -45,8 +61,11 @@ public:
 
     /**
      * @brief Apply the binary operation
+     * 
+     * Проверки принадлежности управляются CRYPTOMATH_CHECKED_OPERATIONS.
      */
     T operate(const T& a, const T& b) const {
+#if CRYPTOMATH_CHECKED_OPERATIONS
         if (!elements_.contains(a) || !elements_.contains(b)) {
             throw std::domain_error("Elements not in groupoid");
         }
@@ -55,6 +74,20 @@ public:
             throw std::runtime_error("Closure violation detected");
         }
         return result;
+#else
+        return operation_(a, b);
+#endif
+    }
+
+    /**
+     * @brief Применить бинарную операцию без проверок принадлежности
+     * 
+     * Предусловие: a и b принадлежат множеству. Результат тогда лежит в множестве
+     * по свойству замкнутости, проверенному в конструкторе. Используется
+     * алгоритмами библиотеки после однократной проверки входных данных.
+     */
+    T operate_unchecked(const T& a, const T& b) const {
+        return operation_(a, b);
     }
 
     /**
@@ -71,6 +104,49 @@ public:
         return elements_;
     }
 
+    /**
+     * @brief Получить элементы в виде упорядоченного массива
+     * 
+     * Порядок совпадает с порядком обхода get_set(). Позиция элемента в массиве
+     * является его индексом в плотных таблицах (например, таблице обратных элементов).
+     */
+    const std::vector<T>& indexed_elements() const noexcept {
+        return indexed_elements_;
+    }
+
+    /**
+     * @brief Найти индекс элемента
+     * 
+     * @return Индекс элемента или std::nullopt, если элемент не принадлежит множеству
+     */
+    std::optional<size_t> find_index(const T& a) const {
+        auto it = std::lower_bound(indexed_elements_.begin(), indexed_elements_.end(), a);
+        if (it == indexed_elements_.end() || a < *it) {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(it - indexed_elements_.begin());
+    }
+
+    /**
+     * @brief Получить индекс элемента
+     * 
+     * @throws std::domain_error если элемент не принадлежит множеству
+     */
+    size_t index_of(const T& a) const {
+        auto index = find_index(a);
+        if (!index.has_value()) {
+            throw std::domain_error("Element not in groupoid");
+        }
+        return *index;
+    }
+
+    /**
+     * @brief Получить элемент по индексу
+     */
+    const T& element_at(size_t index) const noexcept {
+        return indexed_elements_[index];
+    }
+
     /**
      * @brief Получить операцию
      */
@@ -87,8 +163,8 @@ public:
         for (const auto& a : elements_) {
             for (const auto& b : elements_) {
                 for (const auto& c : elements_) {
-                    T left = operate(operate(a, b), c);
-                    T right = operate(a, operate(b, c));
+                    T left = operate_unchecked(operate_unchecked(a, b), c);
+                    T right = operate_unchecked(a, operate_unchecked(b, c));
                     if (left != right) {
                         return false;
                     }
@@ -106,7 +182,7 @@ public:
     bool is_commutative() const {
         for (const auto& a : elements_) {
             for (const auto& b : elements_) {
-                if (operate(a, b) != operate(b, a)) {
+                if (operate_unchecked(a, b) != operate_unchecked(b, a)) {
                     return false;
                 }
             }
@@ -121,7 +197,7 @@ public:
      */
     bool is_idempotent() const {
         for (const auto& a : elements_) {
-            if (operate(a, a) != a) {
+            if (operate_unchecked(a, a) != a) {
                 return false;
             }
         }
@@ -137,7 +213,7 @@ public:
         for (const auto& a : elements_) {
             for (const auto& b : elements_) {
                 for (const auto& c : elements_) {
-                    if (operate(a, b) == operate(a, c) && b != c) {
+                    if (operate_unchecked(a, b) == operate_unchecked(a, c) && b != c) {
                         return false;
                     }
                 }
@@ -155,7 +231,7 @@ public:
         for (const auto& a : elements_) {
             for (const auto& b : elements_) {
                 for (const auto& c : elements_) {
-                    if (operate(b, a) == operate(c, a) && b != c) {
+                    if (operate_unchecked(b, a) == operate_unchecked(c, a) && b != c) {
                         return false;
                     }
                 }
@@ -189,6 +265,7 @@ public:
 protected:
     set_type elements_;
     Op operation_;
+    std::vector<T> indexed_elements_; // Элементы в порядке индексов (отсортированы)
 };
 
 } // namespace cryptomath
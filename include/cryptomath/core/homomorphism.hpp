@@ -0,0 +1,208 @@
+#pragma once
+
+#include "group.hpp"
+#include "mapping.hpp"
+#include "subgroup.hpp"
+#include "normal_subgroup.hpp"
+#include "concepts.hpp"
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Гомоморфизм групп φ: G → H, заданный образами порождающих
+ *
+ * φ восстанавливается обходом в ширину графа Кэли группы G относительно
+ * порождающих g₁, ..., g_k: φ(e) = e', φ(x ∘ gᵢ) = φ(x) ∘ φ(gᵢ). Каждое ребро графа
+ * проверяется на согласованность, то есть проверяются все соотношения между
+ * порождающими, и гомоморфность устанавливается за O(k · |G|) операций вместо
+ * O(|G|²) при проверке φ(a ∘ b) = φ(a) ∘ φ(b) для всех пар.
+ *
+ * Граф отображения хранится в Mapping (таблица индексов), ядро и образ
+ * вычисляются при первом обращении по обратному индексу отображения.
+ */
+template<typename T, typename Op, typename U, typename OpU>
+    requires GroupConcept<T, Op> && GroupConcept<U, OpU>
+class GroupHomomorphism {
+public:
+    using source_type = Group<T, Op>;
+    using target_type = Group<U, OpU>;
+    using mapping_type = Mapping<T, U>;
+
+    /**
+     * @brief Построить гомоморфизм по образам порождающих
+     *
+     * @param generators Порождающие группы source
+     * @param images images[i] = φ(generators[i])
+     * @throws std::invalid_argument если размеры списков различны, элементы
+     *         не порождают source или образы не задают гомоморфизм
+     * @throws std::domain_error если порождающий или образ не принадлежит своей группе
+     */
+    GroupHomomorphism(const source_type& source, const target_type& target,
+                      const std::vector<T>& generators, const std::vector<U>& images)
+        : source_(source), target_(target), generators_(generators), images_(images),
+          mapping_(build_mapping()) {}
+
+    /**
+     * @brief Применить гомоморфизм к элементу
+     */
+    U operator()(const T& x) const {
+        return mapping_(x);
+    }
+
+    /**
+     * @brief Получить граф гомоморфизма в виде отображения
+     */
+    const mapping_type& mapping() const noexcept {
+        return mapping_;
+    }
+
+    const source_type& source() const noexcept {
+        return source_;
+    }
+
+    const target_type& target() const noexcept {
+        return target_;
+    }
+
+    const std::vector<T>& generators() const noexcept {
+        return generators_;
+    }
+
+    const std::vector<U>& generator_images() const noexcept {
+        return images_;
+    }
+
+    /**
+     * @brief Ядро: ker φ = φ⁻¹(e') - нормальная подгруппа G
+     *
+     * Слой единицы берётся из обратного индекса отображения; нормальность ядра
+     * гарантирована, поэтому проверка не выполняется.
+     */
+    const NormalSubgroup<T, Op>& kernel() const {
+        if (!kernel_.has_value()) {
+            kernel_.emplace(source_, mapping_.preimage(target_.identity()), trusted_subgroup);
+        }
+        return *kernel_;
+    }
+
+    /**
+     * @brief Образ: im φ - подгруппа H
+     */
+    const Subgroup<U, OpU>& image() const {
+        if (!image_.has_value()) {
+            image_.emplace(target_, mapping_.image(), trusted_subgroup);
+        }
+        return *image_;
+    }
+
+    /**
+     * @brief Инъективность: ker φ = {e}
+     */
+    bool is_injective() const {
+        return identity_fibre_size() == 1;
+    }
+
+    /**
+     * @brief Сюръективность: |G| / |ker φ| = |H|
+     */
+    bool is_surjective() const {
+        return source_.get_set().size() / identity_fibre_size() == target_.get_set().size();
+    }
+
+    /**
+     * @brief Проверить, является ли гомоморфизм изоморфизмом
+     */
+    bool is_isomorphism() const {
+        return is_injective() && is_surjective();
+    }
+
+    /**
+     * @brief Проверить утверждение первой теоремы об изоморфизме: G / ker φ ≅ im φ
+     *
+     * Отображение g·ker φ ↦ φ(g) корректно и инъективно тогда и только тогда, когда
+     * каждый непустой слой φ является смежным классом ядра, то есть имеет размер
+     * |ker φ|. Проверка выполняется за O(|H|) по обратному индексу.
+     */
+    bool verify_first_isomorphism() const {
+        const size_t kernel_size = identity_fibre_size();
+        for (size_t j = 0; j < target_.get_set().size(); ++j) {
+            const size_t fibre_size = mapping_.fibre(j).size();
+            if (fibre_size != 0 && fibre_size != kernel_size) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t unassigned = std::numeric_limits<size_t>::max();
+
+    size_t identity_fibre_size() const {
+        return mapping_.fibre(target_.index_of(target_.identity())).size();
+    }
+
+    mapping_type build_mapping() const {
+        if (generators_.size() != images_.size()) {
+            throw std::invalid_argument("Each generator must have exactly one image");
+        }
+        for (const auto& g : generators_) {
+            if (!source_.get_set().contains(g)) {
+                throw std::domain_error("Generator not in source group");
+            }
+        }
+        for (const auto& h : images_) {
+            if (!target_.get_set().contains(h)) {
+                throw std::domain_error("Generator image not in target group");
+            }
+        }
+
+        const size_t n = source_.get_set().size();
+        std::vector<size_t> table(n, unassigned);
+        std::vector<size_t> queue;
+        queue.reserve(n);
+
+        const size_t root = source_.index_of(source_.identity());
+        table[root] = target_.index_of(target_.identity());
+        queue.push_back(root);
+
+        // Обход графа Кэли: каждое ребро x → x ∘ gᵢ либо открывает новый элемент,
+        // либо проверяет соотношение φ(x ∘ gᵢ) = φ(x) ∘ φ(gᵢ)
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const size_t x = queue[head];
+            const T& x_element = source_.element_at(x);
+            const U& x_image = target_.element_at(table[x]);
+
+            for (size_t i = 0; i < generators_.size(); ++i) {
+                const size_t y = source_.index_of(source_.operate_unchecked(x_element, generators_[i]));
+                const size_t y_image = target_.index_of(target_.operate_unchecked(x_image, images_[i]));
+                if (table[y] == unassigned) {
+                    table[y] = y_image;
+                    queue.push_back(y);
+                } else if (table[y] != y_image) {
+                    throw std::invalid_argument("Generator images do not define a homomorphism");
+                }
+            }
+        }
+
+        if (queue.size() != n) {
+            throw std::invalid_argument("Elements do not generate the source group");
+        }
+
+        return mapping_type::from_table(source_.get_set(), target_.get_set(), std::move(table));
+    }
+
+    const source_type& source_;
+    const target_type& target_;
+    std::vector<T> generators_;
+    std::vector<U> images_;
+    mapping_type mapping_;
+    mutable std::optional<NormalSubgroup<T, Op>> kernel_; // Лениво вычисленное ядро
+    mutable std::optional<Subgroup<U, OpU>> image_;       // Лениво вычисленный образ
+};
+
+} // namespace cryptomath
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "set.hpp"
+#include <algorithm>
 #include <map>
-#include <unordered_map>
-#include <functional>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <vector>
+#include <concepts>
 #include <stdexcept>
 #include <type_traits>
 
@@ -14,6 +18,18 @@ namespace cryptomath {
  * 
  * Представляет отображение f: A → B, где A - область определения, а B - область значений.
  * Поддерживает проверку инъективности, сюръективности, биективности и композиции.
+ * 
+ * Элементы A и B нумеруются по возрастанию, а граф отображения хранится как
+ * массив индексов: table()[i] - номер f(aᵢ) в B. Вычисление по индексу - одно
+ * обращение к массиву, по элементу - двоичный поиск в A; композиция, обращение,
+ * образ и прообраз выполняются проходами по массивам без построения деревьев.
+ * Форма std::map доступна через to_map().
+ * 
+ * Запросы прообразов, инъективности и сюръективности обслуживает обратный индекс
+ * (для каждого элемента B - индексы его прообразов подряд, CSR), который строится
+ * при первом обращении за O(|A| + |B|). Построение индекса изменяет объект внутри
+ * константного метода, поэтому отображение, используемое из нескольких потоков,
+ * требует внешней блокировки.
  */
 template<typename Domain, typename Codomain>
 class Mapping {
@@ -25,17 +41,23 @@ public:
 
     /**
      * @brief Построить отображение из области определения, области значений и функции
+     * 
+     * Функция передаётся как параметр шаблона и вычисляется один раз для каждого
+     * элемента области определения; дальнейшие вызовы обращаются к таблице индексов.
      */
-    Mapping(const domain_set& domain, const codomain_set& codomain,
-            std::function<Codomain(const Domain&)> func)
-        : domain_(domain), codomain_(codomain), function_(func) {
-        // Проверяем, что функция отображает в область значений
-        for (const auto& x : domain_) {
-            Codomain y = function_(x);
-            if (!codomain_.contains(y)) {
+    template<typename Func>
+        requires std::invocable<const Func&, const Domain&> &&
+                 std::convertible_to<std::invoke_result_t<const Func&, const Domain&>, Codomain>
+    Mapping(const domain_set& domain, const codomain_set& codomain, Func func)
+        : Mapping(domain, codomain) {
+        table_.reserve(domain_elements_.size());
+        for (const auto& x : domain_elements_) {
+            // Проверяем, что функция отображает в область значений
+            auto index = find_codomain_index(func(x));
+            if (!index.has_value()) {
                 throw std::invalid_argument("Function maps outside codomain");
             }
-            mapping_[x] = y;
+            table_.push_back(*index);
         }
     }
 
@@ -44,33 +66,119 @@ public:
      */
     Mapping(const domain_set& domain, const codomain_set& codomain,
             const std::map<Domain, Codomain>& mapping_map)
-        : domain_(domain), codomain_(codomain), mapping_(mapping_map) {
+        : Mapping(domain, codomain) {
         // Проверяем отображение
-        for (const auto& [x, y] : mapping_) {
+        table_.reserve(mapping_map.size());
+        for (const auto& [x, y] : mapping_map) {
             if (!domain_.contains(x)) {
                 throw std::invalid_argument("Mapping contains element not in domain");
             }
-            if (!codomain_.contains(y)) {
+            auto index = find_codomain_index(y);
+            if (!index.has_value()) {
                 throw std::invalid_argument("Mapping contains element not in codomain");
             }
+            table_.push_back(*index);
+        }
+        // Все ключи лежат в области определения и различны, поэтому при равенстве
+        // размеров ключи совпадают с областью определения в том же порядке
+        if (table_.size() != domain_elements_.size()) {
+            throw std::invalid_argument("Not all domain elements are mapped");
+        }
+    }
+
+    /**
+     * @brief Построить отображение из таблицы индексов
+     * 
+     * @param table table[i] - индекс образа i-го по возрастанию элемента domain
+     *        среди элементов codomain по возрастанию
+     * @throws std::invalid_argument если размер таблицы не равен |domain|
+     *         или индекс выходит за пределы codomain
+     */
+    static Mapping from_table(const domain_set& domain, const codomain_set& codomain,
+                              std::vector<size_t> table) {
+        Mapping result(domain, codomain);
+        if (table.size() != result.domain_elements_.size()) {
+            throw std::invalid_argument("Not all domain elements are mapped");
         }
-        // Убеждаемся, что все элементы области определения отображены
-        for (const auto& x : domain_) {
-            if (mapping_.find(x) == mapping_.end()) {
-                throw std::invalid_argument("Not all domain elements are mapped");
+        for (size_t j : table) {
+            if (j >= result.codomain_elements_.size()) {
+                throw std::invalid_argument("Mapping contains element not in codomain");
             }
         }
+        result.table_ = std::move(table);
+        return result;
     }
 
     /**
      * @brief Применить отображение к элементу
      */
     Codomain operator()(const Domain& x) const {
-        auto it = mapping_.find(x);
-        if (it == mapping_.end()) {
+        auto index = find_domain_index(x);
+        if (!index.has_value()) {
             throw std::domain_error("Element not in domain");
         }
-        return it->second;
+        return codomain_elements_[table_[*index]];
+    }
+
+    /**
+     * @brief Применить отображение к элементу с индексом i: индекс образа в codomain
+     */
+    size_t apply_index(size_t i) const noexcept {
+        return table_[i];
+    }
+
+    /**
+     * @brief Получить таблицу индексов образов
+     */
+    const std::vector<size_t>& table() const noexcept {
+        return table_;
+    }
+
+    /**
+     * @brief Элементы области определения в порядке индексов
+     */
+    const std::vector<Domain>& domain_elements() const noexcept {
+        return domain_elements_;
+    }
+
+    /**
+     * @brief Элементы области значений в порядке индексов
+     */
+    const std::vector<Codomain>& codomain_elements() const noexcept {
+        return codomain_elements_;
+    }
+
+    /**
+     * @brief Найти индекс элемента области определения
+     */
+    std::optional<size_t> find_domain_index(const Domain& x) const {
+        auto it = std::lower_bound(domain_elements_.begin(), domain_elements_.end(), x);
+        if (it == domain_elements_.end() || x < *it) {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(it - domain_elements_.begin());
+    }
+
+    /**
+     * @brief Найти индекс элемента области значений
+     */
+    std::optional<size_t> find_codomain_index(const Codomain& y) const {
+        auto it = std::lower_bound(codomain_elements_.begin(), codomain_elements_.end(), y);
+        if (it == codomain_elements_.end() || y < *it) {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(it - codomain_elements_.begin());
+    }
+
+    /**
+     * @brief Получить граф отображения в виде std::map
+     */
+    std::map<Domain, Codomain> to_map() const {
+        std::map<Domain, Codomain> result;
+        for (size_t i = 0; i < table_.size(); ++i) {
+            result.emplace_hint(result.end(), domain_elements_[i], codomain_elements_[table_[i]]);
+        }
+        return result;
     }
 
     /**
@@ -91,11 +199,22 @@ public:
      * @brief Получить образ (диапазон) отображения
      */
     codomain_set image() const {
-        codomain_set result;
-        for (const auto& [x, y] : mapping_) {
-            result.insert(y);
+        const PreimageIndex& index = preimage_index();
+        std::vector<Codomain> values;
+        for (size_t j = 0; j < codomain_elements_.size(); ++j) {
+            if (index.offsets[j + 1] != index.offsets[j]) {
+                values.push_back(codomain_elements_[j]);
+            }
         }
-        return result;
+        return codomain_set(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Индексы прообразов элемента области значений с индексом j (по возрастанию)
+     */
+    std::span<const size_t> fibre(size_t j) const {
+        const PreimageIndex& index = preimage_index();
+        return {index.sources.data() + index.offsets[j], index.offsets[j + 1] - index.offsets[j]};
     }
 
     /**
@@ -104,13 +223,11 @@ public:
      * Отображение f: A → B является инъективным, если f(a₁) = f(a₂) влечет a₁ = a₂
      */
     bool is_injective() const {
-        std::unordered_map<Codomain, Domain> seen;
-        for (const auto& [x, y] : mapping_) {
-            auto it = seen.find(y);
-            if (it != seen.end() && it->second != x) {
+        const PreimageIndex& index = preimage_index();
+        for (size_t j = 0; j < codomain_elements_.size(); ++j) {
+            if (index.offsets[j + 1] - index.offsets[j] > 1) {
                 return false; // Два разных элемента отображаются в одно значение
             }
-            seen[y] = x;
         }
         return true;
     }
@@ -121,8 +238,13 @@ public:
      * Отображение f: A → B является сюръективным, если для каждого b ∈ B существует a ∈ A такое, что f(a) = b
      */
     bool is_surjective() const {
-        codomain_set image_set = image();
-        return image_set == codomain_;
+        const PreimageIndex& index = preimage_index();
+        for (size_t j = 0; j < codomain_elements_.size(); ++j) {
+            if (index.offsets[j + 1] == index.offsets[j]) {
+                return false;
+            }
+        }
+        return true;
     }
 
     /**
@@ -131,7 +253,7 @@ public:
      * Отображение является биективным, если оно одновременно инъективно и сюръективно
      */
     bool is_bijective() const {
-        return is_injective() && is_surjective();
+        return domain_elements_.size() == codomain_elements_.size() && is_injective();
     }
 
     /**
@@ -144,12 +266,12 @@ public:
             throw std::logic_error("Inverse only exists for bijective mappings");
         }
 
-        std::map<Codomain, Domain> inverse_map;
-        for (const auto& [x, y] : mapping_) {
-            inverse_map[y] = x;
+        std::vector<size_t> inverse_table(table_.size());
+        for (size_t i = 0; i < table_.size(); ++i) {
+            inverse_table[table_[i]] = i;
         }
 
-        return Mapping<Codomain, Domain>(codomain_, domain_, inverse_map);
+        return Mapping<Codomain, Domain>::from_table(codomain_, domain_, std::move(inverse_table));
     }
 
     /**
@@ -158,31 +280,33 @@ public:
      * Возвращает множество всех элементов области определения, которые отображаются в данный элемент области значений
      */
     domain_set preimage(const Codomain& y) const {
-        domain_set result;
-        for (const auto& [x, mapped_y] : mapping_) {
-            if (mapped_y == y) {
-                result.insert(x);
-            }
+        auto index = find_codomain_index(y);
+        if (!index.has_value()) {
+            return domain_set{};
         }
-        return result;
+        return collect_domain(fibre(*index));
     }
 
     /**
      * @brief Получить прообраз множества
      */
     domain_set preimage(const codomain_set& Y) const {
-        domain_set result;
+        std::vector<size_t> sources;
         for (const auto& y : Y) {
-            domain_set preimage_y = preimage(y);
-            result = result.union_with(preimage_y);
+            if (auto index = find_codomain_index(y)) {
+                auto part = fibre(*index);
+                sources.insert(sources.end(), part.begin(), part.end());
+            }
         }
-        return result;
+        std::sort(sources.begin(), sources.end());
+        return collect_domain(sources);
     }
 
     /**
      * @brief Композиция отображений: (g ∘ f)(x) = g(f(x))
      * 
-     * Составляет композицию этого отображения f: A → B с g: B → C, чтобы получить g ∘ f: A → C
+     * Составляет композицию этого отображения f: A → B с g: B → C, чтобы получить g ∘ f: A → C.
+     * Таблица результата - g.table()[f.table()[i]].
      */
     template<typename OtherCodomain>
     Mapping<Domain, OtherCodomain> compose(const Mapping<Codomain, OtherCodomain>& g) const {
@@ -191,12 +315,13 @@ public:
             throw std::domain_error("Codomain of first mapping must equal domain of second");
         }
 
-        std::map<Domain, OtherCodomain> composed_map;
-        for (const auto& [x, y] : mapping_) {
-            composed_map[x] = g(y);
+        std::vector<size_t> composed_table(table_.size());
+        for (size_t i = 0; i < table_.size(); ++i) {
+            composed_table[i] = g.apply_index(table_[i]);
         }
 
-        return Mapping<Domain, OtherCodomain>(domain_, g.codomain(), composed_map);
+        return Mapping<Domain, OtherCodomain>::from_table(domain_, g.codomain(),
+                                                          std::move(composed_table));
     }
 
     /**
@@ -205,7 +330,7 @@ public:
     bool operator==(const Mapping& other) const {
         return domain_ == other.domain_ && 
                codomain_ == other.codomain_ &&
-               mapping_ == other.mapping_;
+               table_ == other.table_;
     }
 
     /**
@@ -216,10 +341,62 @@ public:
     }
 
 private:
+    /**
+     * @brief Пустое отображение: индексирует области, таблицу заполняет вызывающий
+     */
+    Mapping(const domain_set& domain, const codomain_set& codomain)
+        : domain_(domain), codomain_(codomain),
+          domain_elements_(domain.begin(), domain.end()),
+          codomain_elements_(codomain.begin(), codomain.end()) {}
+
+    /**
+     * @brief Обратный индекс: прообразы j-го элемента B - sources[offsets[j], offsets[j + 1])
+     */
+    struct PreimageIndex {
+        std::vector<size_t> offsets;
+        std::vector<size_t> sources;
+    };
+
+    const PreimageIndex& preimage_index() const {
+        if (!preimage_index_.has_value()) {
+            PreimageIndex index;
+            index.offsets.assign(codomain_elements_.size() + 1, 0);
+            for (size_t j : table_) {
+                ++index.offsets[j + 1];
+            }
+            for (size_t j = 0; j < codomain_elements_.size(); ++j) {
+                index.offsets[j + 1] += index.offsets[j];
+            }
+            // Проход по возрастанию i оставляет каждый слой упорядоченным
+            index.sources.resize(table_.size());
+            std::vector<size_t> fill(index.offsets.begin(), index.offsets.end() - 1);
+            for (size_t i = 0; i < table_.size(); ++i) {
+                index.sources[fill[table_[i]]++] = i;
+            }
+            preimage_index_ = std::move(index);
+        }
+        return *preimage_index_;
+    }
+
+    /**
+     * @brief Множество элементов A с упорядоченными по возрастанию индексами
+     */
+    template<typename Indices>
+    domain_set collect_domain(const Indices& indices) const {
+        std::vector<Domain> values;
+        values.reserve(indices.size());
+        for (size_t i : indices) {
+            values.push_back(domain_elements_[i]);
+        }
+        return domain_set(values.begin(), values.end());
+    }
+
     domain_set domain_;
     codomain_set codomain_;
-    std::map<Domain, Codomain> mapping_;
-    std::function<Codomain(const Domain&)> function_;
+    std::vector<Domain> domain_elements_;     // Элементы A по возрастанию
+    std::vector<Codomain> codomain_elements_; // Элементы B по возрастанию
+    std::vector<size_t> table_;               // table_[i] - индекс образа i-го элемента A
+    mutable std::optional<PreimageIndex> preimage_index_; // Лениво построенный обратный индекс
 };
 
 /**
@@ -235,12 +412,9 @@ Mapping<A, C> operator*(const Mapping<B, C>& g, const Mapping<A, B>& f) {
  */
 template<typename T>
 Mapping<T, T> identity_mapping(const Set<T>& domain) {
-    std::map<T, T> identity_map;
-    for (const auto& x : domain) {
-        identity_map[x] = x;
-    }
-    return Mapping<T, T>(domain, domain, identity_map);
+    std::vector<size_t> table(domain.size());
+    std::iota(table.begin(), table.end(), size_t{0});
+    return Mapping<T, T>::from_table(domain, domain, std::move(table));
 }
 
 } // namespace cryptomath
-
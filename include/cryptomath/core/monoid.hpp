@@ -40,12 +40,12 @@ public:
 
         // Проверяем свойство единицы
         for (const auto& a : this->elements_) {
-            if (this->operate(identity_, a) != a) {
+            if (this->operate_unchecked(identity_, a) != a) {
                 throw std::invalid_argument(
                     "Element does not satisfy left identity property"
                 );
             }
-            if (this->operate(a, identity_) != a) {
+            if (this->operate_unchecked(a, identity_) != a) {
                 throw std::invalid_argument(
                     "Element does not satisfy right identity property"
                 );
@@ -78,31 +78,43 @@ public:
     /**
      * @brief Вычислить степень элемента: a^n
      * 
-     * Для моноида, a^0 = e (единичный элемент)
+     * Для моноида, a^0 = e (единичный элемент).
+     * Использует возведение скользящим окном.
      */
     T power(const T& a, size_t n) const {
-        if (n == 0) {
-            return identity_;
+        if (!this->elements_.contains(a)) {
+            throw std::domain_error("Elements not in groupoid");
         }
 
-        if (n == 1) {
-            return a;
+        if (n == 0) {
+            return identity_;
         }
 
-        // Используем бинарное возведение в степень
-        T result = identity_;
-        T current_power = a;
-        size_t exp = n;
+        return detail::sliding_window_power(a, n, [this](const T& x, const T& y) {
+            return this->operate_unchecked(x, y);
+        });
+    }
 
-        while (exp > 0) {
-            if (exp % 2 == 1) {
-                result = this->operate(result, current_power);
-            }
-            current_power = this->operate(current_power, current_power);
-            exp /= 2;
+    /**
+     * @brief Вычислить a^n лестницей Монтгомери
+     * 
+     * Последовательность операций не зависит от n (см. detail::montgomery_ladder_power),
+     * а операнды выбираются условным обменом без ветвления: Op::conditional_swap,
+     * если операция его предоставляет, иначе обмен байтов по маске для тривиально
+     * копируемых T (detail::conditional_swap). Метод предназначен для секретных показателей.
+     */
+    T power_ladder(const T& a, size_t n) const {
+        if (!this->elements_.contains(a)) {
+            throw std::domain_error("Elements not in groupoid");
         }
 
-        return result;
+        return detail::montgomery_ladder_power(identity_, a, n,
+            [this](const T& x, const T& y) {
+                return this->operate_unchecked(x, y);
+            },
+            [this](T& x, T& y, bool bit) {
+                detail::conditional_swap(this->operation_, x, y, bit);
+            });
     }
 
     /**
@@ -117,8 +129,8 @@ public:
             // Проверяем, имеет ли a обратный элемент
             bool has_inverse = false;
             for (const auto& b : this->elements_) {
-                if (this->operate(a, b) == identity_ &&
-                    this->operate(b, a) == identity_) {
+                if (this->operate_unchecked(a, b) == identity_ &&
+                    this->operate_unchecked(b, a) == identity_) {
                     has_inverse = true;
                     break;
                 }
@@ -138,8 +150,8 @@ public:
             return false;
         }
         for (const auto& b : this->elements_) {
-            if (this->operate(a, b) == identity_ &&
-                this->operate(b, a) == identity_) {
+            if (this->operate_unchecked(a, b) == identity_ &&
+                this->operate_unchecked(b, a) == identity_) {
                 return true;
             }
         }
@@ -158,8 +170,8 @@ public:
 
         // Находим обратный элемент (он единственен, если существует)
         for (const auto& b : this->elements_) {
-            if (this->operate(a, b) == identity_ &&
-                this->operate(b, a) == identity_) {
+            if (this->operate_unchecked(a, b) == identity_ &&
+                this->operate_unchecked(b, a) == identity_) {
                 return b;
             }
         }
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "group.hpp"
+#include "subgroup.hpp"
+#include "normal_subgroup.hpp"
+#include "conjugacy_classes.hpp"
+#include "set.hpp"
+#include <algorithm>
+#include <concepts>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Нормальное замыкание множества элементов
+ *
+ * Нормальное замыкание S^G - наименьшая нормальная подгруппа, содержащая S,
+ * то есть подгруппа, порождённая всеми сопряжёнными g ∘ s ∘ g⁻¹.
+ *
+ * Строится замыканием орбиты: список порождающих пополняется сопряжёнными
+ * порождающих с порождающими G, пока все они не окажутся в построенной
+ * подгруппе. Сопряжение порождающими G - автоморфизм, поэтому проверка только
+ * порождающих достаточна для нормальности.
+ */
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class NormalClosure {
+public:
+    using group_type = Group<T, Op>;
+    using set_type = Set<T>;
+
+    /**
+     * @brief Вычислить нормальное замыкание элементов
+     *
+     * @throws std::domain_error если элемент не принадлежит группе
+     */
+    static NormalSubgroup<T, Op> compute(const group_type& group, const std::vector<T>& elements) {
+        std::vector<size_t> seeds;
+        seeds.reserve(elements.size());
+        for (const auto& x : elements) {
+            seeds.push_back(group.index_of(x));
+        }
+        return to_normal_subgroup(group, closure_indices(group, seeds));
+    }
+
+    /**
+     * @brief Вычислить нормальное замыкание подгруппы (по её порождающим)
+     */
+    static NormalSubgroup<T, Op> compute(const Subgroup<T, Op>& subgroup) {
+        return compute(subgroup.parent_group(), subgroup.generators());
+    }
+
+    /**
+     * @brief Индексы элементов нормального замыкания элементов с индексами seeds
+     */
+    static std::vector<size_t> closure_indices(const group_type& group, const std::vector<size_t>& seeds) {
+        const size_t n = group.indexed_elements().size();
+        const std::vector<size_t>& group_generators = group.generator_indices();
+
+        std::vector<bool> in_closure(n, false);
+        std::vector<size_t> closure{group.index_of(group.identity())};
+        in_closure[closure.front()] = true;
+        std::vector<size_t> generators;
+
+        auto add = [&](size_t x) {
+            if (!in_closure[x]) {
+                generators.push_back(x);
+                detail::extend_closure(group, in_closure, closure, generators);
+            }
+        };
+
+        for (size_t x : seeds) {
+            add(x);
+        }
+        // Сопрягаем каждый порождающий (включая добавленные по ходу) порождающими G
+        for (size_t head = 0; head < generators.size(); ++head) {
+            const size_t x = generators[head];
+            for (size_t s : group_generators) {
+                add(group.operate_indices(group.operate_indices(s, x), group.inverse_index(s)));
+            }
+        }
+
+        return closure;
+    }
+
+    /**
+     * @brief Нормальное ядро подгруппы: core_G(H) = ∩ g H g⁻¹
+     *
+     * Наибольшая нормальная подгруппа G, содержащаяся в H, - это объединение
+     * классов сопряжённости, целиком лежащих в H.
+     */
+    static NormalSubgroup<T, Op> core(const Subgroup<T, Op>& subgroup) {
+        const group_type& group = subgroup.parent_group();
+        const ConjugacyClasses<T, Op> classes(group);
+
+        std::vector<size_t> hits(classes.class_count(), 0);
+        for (const auto& h : subgroup.get_subset()) {
+            ++hits[classes.class_of(h)];
+        }
+
+        std::vector<T> values;
+        for (const auto& h : subgroup.get_subset()) {
+            const size_t c = classes.class_of(h);
+            if (hits[c] == classes.class_size(c)) {
+                values.push_back(h);
+            }
+        }
+        return NormalSubgroup<T, Op>(group, set_type(values.begin(), values.end()), trusted_subgroup);
+    }
+
+    /**
+     * @brief Построить нормальную подгруппу по индексам её элементов
+     */
+    static NormalSubgroup<T, Op> to_normal_subgroup(const group_type& group, std::vector<size_t> indices) {
+        std::sort(indices.begin(), indices.end());
+        std::vector<T> values;
+        values.reserve(indices.size());
+        for (size_t i : indices) {
+            values.push_back(group.element_at(i));
+        }
+        return NormalSubgroup<T, Op>(group, set_type(values.begin(), values.end()), trusted_subgroup);
+    }
+};
+
+} // namespace cryptomath
@@ -2,7 +2,9 @@
 
 #include "subgroup.hpp"
 #include "group.hpp"
+#include <algorithm>
 #include <concepts>
+#include <vector>
 
 namespace cryptomath {
 
@@ -52,50 +54,58 @@ public:
     }
 
     /**
-     * @brief Проверить, что подгруппа является нормальной
+     * @brief Построить нормальную подгруппу без проверки нормальности
      * 
-     * Проверяет: g ∘ n ∘ g⁻¹ ∈ N для всех g ∈ G и n ∈ N
+     * Предусловие: subgroup нормальна (например, является ядром гомоморфизма).
      */
-    bool verify_normal() const {
-        const auto& G = this->parent_group();
-        const auto& N = this->get_subset();
+    NormalSubgroup(const Subgroup<T, Op>& subgroup, trusted_subgroup_t)
+        : base_type(subgroup) {}
 
-        for (const auto& g : G.get_set()) {
-            for (const auto& n : N) {
-                T g_inverse = G.inverse(g);
-                T conjugate = G.operate(G.operate(g, n), g_inverse);
-                if (!N.contains(conjugate)) {
-                    return false;
-                }
-            }
-        }
+    /**
+     * @brief Построить нормальную подгруппу из подмножества без каких-либо проверок
+     * 
+     * Предусловие: subset является нормальной подгруппой parent_group.
+     */
+    NormalSubgroup(const group_type& parent_group, const set_type& subset, trusted_subgroup_t tag)
+        : base_type(parent_group, subset, tag) {}
 
-        return true;
+    /**
+     * @brief Проверить, что подгруппа является нормальной
+     * 
+     * Проверяет: g ∘ n ∘ g⁻¹ ∈ N для всех g ∈ G и n ∈ N.
+     * Достаточно проверить порождающие: сопряжение элементом g - автоморфизм,
+     * поэтому g N g⁻¹ ⊆ N, если g tⱼ g⁻¹ ∈ N для порождающих tⱼ подгруппы N, а
+     * включение для всех g следует из включения для порождающих sᵢ группы G.
+     * Итого O(|порождающих G| · |порождающих N|) проверок принадлежности.
+     */
+    bool verify_normal() const {
+        return is_normal(*this);
     }
 
     /**
      * @brief Альтернативная проверка с использованием смежных классов
      * 
-     * N является нормальной тогда и только тогда, когда g ∘ N = N ∘ g для всех g ∈ G
+     * N является нормальной тогда и только тогда, когда g ∘ N = N ∘ g для всех g ∈ G.
+     * Как и в verify_normal, равенство достаточно проверить для порождающих G.
      */
     bool verify_normal_via_cosets() const {
         const auto& G = this->parent_group();
+        const auto& N = this->get_subset();
 
-        for (const auto& g : G.get_set()) {
+        for (const auto& g : G.generators()) {
             // Вычисляем левый смежный класс: g ∘ N
-            set_type left_coset;
-            for (const auto& n : this->get_subset()) {
-                left_coset.insert(G.operate(g, n));
-            }
-
-            // Вычисляем правый смежный класс: N ∘ g
-            set_type right_coset;
-            for (const auto& n : this->get_subset()) {
-                right_coset.insert(G.operate(n, g));
+            std::vector<T> left_coset;
+            left_coset.reserve(N.size());
+            for (const auto& n : N) {
+                left_coset.push_back(G.operate_unchecked(g, n));
             }
 
-            if (left_coset != right_coset) {
-                return false;
+            // Правый смежный класс N ∘ g равен g ∘ N, если каждый n ∘ g лежит в g ∘ N
+            std::sort(left_coset.begin(), left_coset.end());
+            for (const auto& n : N) {
+                if (!std::binary_search(left_coset.begin(), left_coset.end(), G.operate_unchecked(n, g))) {
+                    return false;
+                }
             }
         }
 
@@ -104,15 +114,18 @@ public:
 
     /**
      * @brief Проверить, является ли подгруппа нормальной (статический метод)
+     * 
+     * Сопрягает порождающие N порождающими G (см. verify_normal).
      */
     static bool is_normal(const Subgroup<T, Op>& subgroup) {
         const auto& G = subgroup.parent_group();
         const auto& N = subgroup.get_subset();
 
-        for (const auto& g : G.get_set()) {
-            for (const auto& n : N) {
-                T g_inverse = G.inverse(g);
-                T conjugate = G.operate(G.operate(g, n), g_inverse);
+        for (size_t s : G.generator_indices()) {
+            const T& g = G.element_at(s);
+            const T& g_inverse = G.element_at(G.inverse_index(s));
+            for (const auto& t : subgroup.generators()) {
+                T conjugate = G.operate_unchecked(G.operate_unchecked(g, t), g_inverse);
                 if (!N.contains(conjugate)) {
                     return false;
                 }
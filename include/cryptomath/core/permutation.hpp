@@ -0,0 +1,444 @@
+#pragma once
+
+#include "set.hpp"
+#include "group.hpp"
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Векторная композиция Permutation<N> с выбором набора инструкций при выполнении
+ *
+ * На x86 при GCC/Clang варианты композиции для SSSE3 и AVX2 компилируются
+ * с атрибутом target независимо от флагов -m, а вызывается тот, который
+ * поддерживает процессор (__builtin_cpu_supports). На других архитектурах и
+ * компиляторах используется скалярный цикл; CRYPTOMATH_PERMUTATION_SIMD = 0
+ * включает его принудительно.
+ */
+#ifndef CRYPTOMATH_PERMUTATION_SIMD
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRYPTOMATH_PERMUTATION_SIMD 1
+#else
+#define CRYPTOMATH_PERMUTATION_SIMD 0
+#endif
+#endif
+
+#if CRYPTOMATH_PERMUTATION_SIMD
+#include <immintrin.h>
+#endif
+
+namespace cryptomath {
+
+/**
+ * @brief Перестановка фиксированной степени N множества {0, 1, ..., N - 1}
+ *
+ * Образы хранятся байтами в выровненном массиве, дополненном до кратного 16
+ * тождественными образами: дополнение сохраняется при композиции и не влияет
+ * на сравнение. Композиция (p ∘ q)(i) = p(q(i)) - это выборка байтов таблицы p
+ * по индексам q, которая выполняется инструкциями перестановки байтов:
+ * - N ≤ 16: одна инструкция pshufb (SSSE3);
+ * - N ≤ 32 при AVX2: две vpshufb по половинам таблицы и смешивание;
+ * - иначе: pshufb по каждому 16-байтному блоку таблицы с маскированием индексов
+ *   вне блока, (N / 16)² инструкций.
+ * Ограничение N ≤ 128 позволяет маскировать индексы знаковым сравнением байтов.
+ *
+ * Векторные варианты доступны только на x86 при GCC/Clang: набор инструкций
+ * проверяется при каждой композиции (одно предсказуемое ветвление), если сборка
+ * не гарантирует его флагами -mssse3 / -mavx2 (CMake-опция CRYPTOMATH_NATIVE
+ * добавляет -march=native). В остальных случаях (MSVC, ARM, процессор без
+ * SSSE3) композиция выполняется скалярным циклом по padded_degree байтам.
+ */
+template<size_t N>
+    requires (N >= 1 && N <= 128)
+class Permutation {
+public:
+    static constexpr size_t degree = N;
+    static constexpr size_t padded_degree = (N + 15) / 16 * 16;
+
+    /**
+     * @brief Тождественная перестановка
+     */
+    Permutation() noexcept {
+        std::iota(images_.begin(), images_.end(), std::uint8_t{0});
+    }
+
+    /**
+     * @brief Построить перестановку по списку образов i ↦ images[i]
+     *
+     * @throws std::invalid_argument если список не является перестановкой {0, ..., N - 1}
+     */
+    Permutation(std::initializer_list<size_t> images)
+        : Permutation(std::vector<size_t>(images)) {}
+
+    explicit Permutation(const std::vector<size_t>& images) : Permutation() {
+        if (images.size() != N) {
+            throw std::invalid_argument("Permutation must list exactly N images");
+        }
+        std::array<bool, N> seen{};
+        for (size_t i = 0; i < N; ++i) {
+            if (images[i] >= N || seen[images[i]]) {
+                throw std::invalid_argument("Images do not form a permutation");
+            }
+            seen[images[i]] = true;
+            images_[i] = static_cast<std::uint8_t>(images[i]);
+        }
+    }
+
+    /**
+     * @brief Цикл (c₀ c₁ ... c_k): cᵢ ↦ cᵢ₊₁, c_k ↦ c₀
+     *
+     * @throws std::invalid_argument если точки повторяются или выходят за пределы степени
+     */
+    static Permutation cycle(std::initializer_list<size_t> points) {
+        std::vector<size_t> images(N);
+        std::iota(images.begin(), images.end(), size_t{0});
+        std::vector<size_t> cycle_points(points);
+        std::array<bool, N> seen{};
+        for (size_t k = 0; k < cycle_points.size(); ++k) {
+            if (cycle_points[k] >= N) {
+                throw std::invalid_argument("Cycle point exceeds permutation degree");
+            }
+            if (seen[cycle_points[k]]) {
+                throw std::invalid_argument("Cycle points must be distinct");
+            }
+            seen[cycle_points[k]] = true;
+            images[cycle_points[k]] = cycle_points[(k + 1) % cycle_points.size()];
+        }
+        return Permutation(images);
+    }
+
+    static Permutation identity() noexcept {
+        return Permutation();
+    }
+
+    /**
+     * @brief Обратная перестановка: p⁻¹(p(i)) = i
+     */
+    static Permutation inverse(const Permutation& p) noexcept {
+        Permutation result;
+        for (size_t i = 0; i < N; ++i) {
+            result.images_[p.images_[i]] = static_cast<std::uint8_t>(i);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Образ точки i
+     */
+    size_t operator()(size_t i) const noexcept {
+        return images_[i];
+    }
+
+    /**
+     * @brief Композиция (p * q)(i) = p(q(i)): сначала применяется q
+     */
+    Permutation operator*(const Permutation& q) const noexcept {
+        Permutation result;
+        compose(images_.data(), q.images_.data(), result.images_.data());
+        return result;
+    }
+
+    /**
+     * @brief Порядок перестановки (НОК длин циклов)
+     */
+    size_t order() const {
+        std::array<bool, N> visited{};
+        size_t result = 1;
+        for (size_t i = 0; i < N; ++i) {
+            size_t length = 0;
+            for (size_t j = i; !visited[j]; j = images_[j]) {
+                visited[j] = true;
+                ++length;
+            }
+            if (length > 0) {
+                result = std::lcm(result, length);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Образы точек 0, ..., N - 1 (и тождественное дополнение)
+     */
+    const std::uint8_t* data() const noexcept {
+        return images_.data();
+    }
+
+    bool operator==(const Permutation& other) const noexcept = default;
+    auto operator<=>(const Permutation& other) const noexcept = default;
+
+private:
+    // out[i] = p[q[i]] для всех padded_degree байтов
+    static void compose(const std::uint8_t* p, const std::uint8_t* q, std::uint8_t* out) noexcept {
+#if CRYPTOMATH_PERMUTATION_SIMD
+        if constexpr (padded_degree == 32) {
+            if (cpu_supports_avx2()) {
+                compose_avx2(p, q, out);
+                return;
+            }
+        }
+        if (cpu_supports_ssse3()) {
+            compose_ssse3(p, q, out);
+            return;
+        }
+#endif
+        compose_scalar(p, q, out);
+    }
+
+    static void compose_scalar(const std::uint8_t* p, const std::uint8_t* q, std::uint8_t* out) noexcept {
+        for (size_t i = 0; i < padded_degree; ++i) {
+            out[i] = p[q[i]];
+        }
+    }
+
+#if CRYPTOMATH_PERMUTATION_SIMD
+    static bool cpu_supports_ssse3() noexcept {
+#if defined(__SSSE3__)
+        return true;
+#else
+        return __builtin_cpu_supports("ssse3");
+#endif
+    }
+
+    static bool cpu_supports_avx2() noexcept {
+#if defined(__AVX2__)
+        return true;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+
+    // Невыровненные загрузки и сохранения: GCC без оптимизации не всегда выравнивает
+    // временные объекты на 32 байта, а на выровненных адресах loadu/storeu не медленнее
+    __attribute__((target("avx2")))
+    static void compose_avx2(const std::uint8_t* p, const std::uint8_t* q, std::uint8_t* out) noexcept {
+        const __m128i* table = reinterpret_cast<const __m128i*>(p);
+        const __m256i low = _mm256_broadcastsi128_si256(_mm_loadu_si128(table));
+        const __m256i high = _mm256_broadcastsi128_si256(_mm_loadu_si128(table + 1));
+        const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q));
+        const __m256i in_high = _mm256_cmpgt_epi8(index, _mm256_set1_epi8(15));
+        const __m256i result = _mm256_blendv_epi8(_mm256_shuffle_epi8(low, index),
+                                                  _mm256_shuffle_epi8(high, index), in_high);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), result);
+    }
+
+    __attribute__((target("ssse3")))
+    static void compose_ssse3(const std::uint8_t* p, const std::uint8_t* q, std::uint8_t* out) noexcept {
+        constexpr size_t blocks = padded_degree / 16;
+        const __m128i* table = reinterpret_cast<const __m128i*>(p);
+        for (size_t k = 0; k < blocks; ++k) {
+            const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q) + k);
+            if constexpr (blocks == 1) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                                 _mm_shuffle_epi8(_mm_loadu_si128(table), index));
+            } else {
+                __m128i result = _mm_setzero_si128();
+                for (size_t b = 0; b < blocks; ++b) {
+                    // Индексы вне блока b получают старший бит, и pshufb даёт для них 0
+                    const __m128i local = _mm_sub_epi8(index, _mm_set1_epi8(static_cast<char>(16 * b)));
+                    const __m128i outside = _mm_cmpgt_epi8(local, _mm_set1_epi8(15));
+                    const __m128i masked = _mm_or_si128(local, outside);
+                    result = _mm_or_si128(result, _mm_shuffle_epi8(_mm_loadu_si128(table + b), masked));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + k, result);
+            }
+        }
+    }
+#endif
+
+    alignas(32) std::array<std::uint8_t, padded_degree> images_;
+};
+
+/**
+ * @brief Перестановка степени, заданной во время выполнения
+ *
+ * Образы хранятся 32-битными индексами; композиция - скалярная выборка
+ * (векторизуемая компилятором через gather при -mavx2). Используется там,
+ * где степень неизвестна на этапе компиляции или превышает 128.
+ */
+class DynamicPermutation {
+public:
+    using point_type = std::uint32_t;
+
+    DynamicPermutation() = default;
+
+    /**
+     * @brief Тождественная перестановка степени n
+     */
+    explicit DynamicPermutation(size_t n) : images_(n) {
+        std::iota(images_.begin(), images_.end(), point_type{0});
+    }
+
+    /**
+     * @brief Построить перестановку по списку образов
+     *
+     * @throws std::invalid_argument если список не является перестановкой
+     */
+    explicit DynamicPermutation(const std::vector<size_t>& images) : images_(images.size()) {
+        std::vector<bool> seen(images.size(), false);
+        for (size_t i = 0; i < images.size(); ++i) {
+            if (images[i] >= images.size() || seen[images[i]]) {
+                throw std::invalid_argument("Images do not form a permutation");
+            }
+            seen[images[i]] = true;
+            images_[i] = static_cast<point_type>(images[i]);
+        }
+    }
+
+    DynamicPermutation(std::initializer_list<size_t> images)
+        : DynamicPermutation(std::vector<size_t>(images)) {}
+
+    /**
+     * @brief Перестановка степени N с теми же образами
+     */
+    template<size_t N>
+    explicit DynamicPermutation(const Permutation<N>& p) : images_(N) {
+        for (size_t i = 0; i < N; ++i) {
+            images_[i] = static_cast<point_type>(p(i));
+        }
+    }
+
+    /**
+     * @brief Цикл степени n
+     *
+     * @throws std::invalid_argument если точки повторяются или выходят за пределы степени
+     */
+    static DynamicPermutation cycle(size_t n, std::initializer_list<size_t> points) {
+        std::vector<size_t> images(n);
+        std::iota(images.begin(), images.end(), size_t{0});
+        std::vector<size_t> cycle_points(points);
+        std::vector<bool> seen(n, false);
+        for (size_t k = 0; k < cycle_points.size(); ++k) {
+            if (cycle_points[k] >= n) {
+                throw std::invalid_argument("Cycle point exceeds permutation degree");
+            }
+            if (seen[cycle_points[k]]) {
+                throw std::invalid_argument("Cycle points must be distinct");
+            }
+            seen[cycle_points[k]] = true;
+            images[cycle_points[k]] = cycle_points[(k + 1) % cycle_points.size()];
+        }
+        return DynamicPermutation(images);
+    }
+
+    static DynamicPermutation identity(size_t n) {
+        return DynamicPermutation(n);
+    }
+
+    static DynamicPermutation inverse(const DynamicPermutation& p) {
+        DynamicPermutation result(p.degree());
+        for (size_t i = 0; i < p.images_.size(); ++i) {
+            result.images_[p.images_[i]] = static_cast<point_type>(i);
+        }
+        return result;
+    }
+
+    size_t degree() const noexcept {
+        return images_.size();
+    }
+
+    size_t operator()(size_t i) const noexcept {
+        return images_[i];
+    }
+
+    /**
+     * @brief Композиция (p * q)(i) = p(q(i))
+     *
+     * @throws std::domain_error если степени различны
+     */
+    DynamicPermutation operator*(const DynamicPermutation& q) const {
+        if (degree() != q.degree()) {
+            throw std::domain_error("Permutations must have the same degree");
+        }
+        DynamicPermutation result;
+        result.images_.resize(images_.size());
+        const point_type* p = images_.data();
+        const point_type* index = q.images_.data();
+        point_type* out = result.images_.data();
+        for (size_t i = 0; i < images_.size(); ++i) {
+            out[i] = p[index[i]];
+        }
+        return result;
+    }
+
+    bool is_identity() const noexcept {
+        for (size_t i = 0; i < images_.size(); ++i) {
+            if (images_[i] != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Порядок перестановки (НОК длин циклов)
+     */
+    size_t order() const {
+        std::vector<bool> visited(images_.size(), false);
+        size_t result = 1;
+        for (size_t i = 0; i < images_.size(); ++i) {
+            size_t length = 0;
+            for (size_t j = i; !visited[j]; j = images_[j]) {
+                visited[j] = true;
+                ++length;
+            }
+            if (length > 0) {
+                result = std::lcm(result, length);
+            }
+        }
+        return result;
+    }
+
+    const std::vector<point_type>& images() const noexcept {
+        return images_;
+    }
+
+    bool operator==(const DynamicPermutation& other) const = default;
+    auto operator<=>(const DynamicPermutation& other) const = default;
+
+private:
+    std::vector<point_type> images_;
+};
+
+/**
+ * @brief Операция композиции перестановок: (p, q) ↦ p * q
+ *
+ * Подходит как параметр Op для Group с элементами Permutation<N> или DynamicPermutation.
+ */
+struct PermutationComposition {
+    template<typename P>
+    P operator()(const P& p, const P& q) const {
+        return p * q;
+    }
+};
+
+/**
+ * @brief Симметрическая группа S_N всех перестановок степени N
+ *
+ * Групповые аксиомы проверяются конструктором Group по таблице Кэли, поэтому
+ * функция предназначена для небольших N (N ≤ 5); большие группы перестановок
+ * задаются порождающими (StabilizerChain).
+ */
+template<size_t N>
+Group<Permutation<N>, PermutationComposition> symmetric_group() {
+    std::vector<size_t> images(N);
+    std::iota(images.begin(), images.end(), size_t{0});
+    std::vector<Permutation<N>> elements;
+    do {
+        elements.emplace_back(images);
+    } while (std::next_permutation(images.begin(), images.end()));
+
+    return Group<Permutation<N>, PermutationComposition>(
+        Set<Permutation<N>>(elements.begin(), elements.end()), PermutationComposition{},
+        Permutation<N>::identity(),
+        [](const Permutation<N>& p) { return Permutation<N>::inverse(p); });
+}
+
+} // namespace cryptomath
@@ -0,0 +1,411 @@
+#pragma once
+
+#include "set.hpp"
+#include "relation.hpp"
+#include "bit_matrix.hpp"
+#include "relation_graph.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Частично упорядоченное множество, заданное отношением частичного порядка
+ *
+ * Все алгоритмы работают над индексами элементов отношения (Relation::indexed_elements):
+ * - диаграмма Хассе (транзитивная редукция) строится битовыми строками;
+ * - линейное расширение - алгоритмом Кана по диаграмме Хассе;
+ * - ширина и разбиение на минимальное число цепей (теорема Дилуорса) -
+ *   максимальным паросочетанием Хопкрофта–Карпа в двудольном графе сравнимости.
+ * Производные структуры строятся при первом обращении и переиспользуются.
+ */
+template<typename T>
+class PartialOrder {
+public:
+    using element_type = T;
+    using set_type = Set<T>;
+    using relation_type = Relation<T>;
+
+    /**
+     * @brief Построить частичный порядок из отношения
+     *
+     * @param assume_partial_order Не проверять рефлексивность, антисимметричность
+     *        и транзитивность отношения
+     * @throws std::logic_error если отношение не является частичным порядком
+     */
+    explicit PartialOrder(const relation_type& relation, bool assume_partial_order = false)
+        : relation_(relation) {
+        if (!assume_partial_order && !relation_.is_partial_order()) {
+            throw std::logic_error("Relation must be a partial order");
+        }
+        topological_order_ = compute_topological_order();
+    }
+
+    /**
+     * @brief Получить отношение порядка
+     */
+    const relation_type& relation() const noexcept {
+        return relation_;
+    }
+
+    /**
+     * @brief Получить базовое множество
+     */
+    const set_type& get_set() const noexcept {
+        return relation_.get_set();
+    }
+
+    /**
+     * @brief Число элементов
+     */
+    size_t size() const noexcept {
+        return relation_.indexed_elements().size();
+    }
+
+    /**
+     * @brief Проверить a ≤ b
+     */
+    bool less_equal(const T& a, const T& b) const {
+        return relation_.related(a, b);
+    }
+
+    /**
+     * @brief Проверить a < b
+     */
+    bool less(const T& a, const T& b) const {
+        return a != b && relation_.related(a, b);
+    }
+
+    /**
+     * @brief Проверить, сравнимы ли a и b
+     */
+    bool comparable(const T& a, const T& b) const {
+        return relation_.related(a, b) || relation_.related(b, a);
+    }
+
+    /**
+     * @brief Проверить, покрывает ли b элемент a (a < b и нет c: a < c < b)
+     */
+    bool covers(const T& a, const T& b) const {
+        if (!get_set().contains(a) || !get_set().contains(b)) {
+            return false;
+        }
+        return hasse_diagram().has_edge(relation_.index_of(a), relation_.index_of(b));
+    }
+
+    /**
+     * @brief Диаграмма Хассе (отношение покрытия) над индексами элементов
+     *
+     * Для каждого элемента v его строгие верхние грани w перебираются в порядке
+     * топологической сортировки. Грань w покрывает v, если не отмечена, после чего
+     * отмечается вся строка w матрицы порядка (все элементы ≥ w). Каждая
+     * покрывающая пара стоит O(|A| / 64) слов, остальные - O(1).
+     */
+    const RelationGraph& hasse_diagram() const {
+        if (!hasse_.has_value()) {
+            const size_t n = size();
+            const RelationGraph& order = relation_.graph();
+            const BitMatrix& matrix = relation_.bit_matrix();
+
+            std::vector<size_t> position(n);
+            for (size_t k = 0; k < n; ++k) {
+                position[topological_order_[k]] = k;
+            }
+
+            std::vector<std::pair<size_t, size_t>> covers;
+            std::vector<size_t> upper;
+            BitMatrix marked(1, n);
+            for (size_t v = 0; v < n; ++v) {
+                upper.clear();
+                for (size_t w : order.neighbors(v)) {
+                    if (w != v) {
+                        upper.push_back(w);
+                    }
+                }
+                std::sort(upper.begin(), upper.end(), [&](size_t a, size_t b) {
+                    return position[a] < position[b];
+                });
+
+                marked.clear_row(0);
+                for (size_t w : upper) {
+                    if (!marked.test(0, w)) {
+                        covers.emplace_back(v, w);
+                        marked.or_row(0, matrix, w);
+                    }
+                }
+            }
+            hasse_ = RelationGraph(n, std::move(covers));
+        }
+        return *hasse_;
+    }
+
+    /**
+     * @brief Отношение покрытия (транзитивная редукция) в виде Relation
+     */
+    relation_type covering_relation() const {
+        const auto& elements = relation_.indexed_elements();
+        const RelationGraph& hasse = hasse_diagram();
+        std::vector<std::pair<T, T>> pairs;
+        pairs.reserve(hasse.edge_count());
+        for (size_t v = 0; v < hasse.vertex_count(); ++v) {
+            for (size_t w : hasse.neighbors(v)) {
+                pairs.emplace_back(elements[v], elements[w]);
+            }
+        }
+        return relation_type(get_set(), Set<std::pair<T, T>>(pairs.begin(), pairs.end()));
+    }
+
+    /**
+     * @brief Линейное расширение порядка (топологическая сортировка)
+     *
+     * Если a < b, то a стоит в результате раньше b.
+     */
+    std::vector<T> linear_extension() const {
+        const auto& elements = relation_.indexed_elements();
+        std::vector<T> result;
+        result.reserve(size());
+        for (size_t v : topological_order_) {
+            result.push_back(elements[v]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Минимальные элементы (не имеющие строгих нижних граней)
+     */
+    set_type minimal_elements() const {
+        const RelationGraph& hasse = hasse_diagram();
+        std::vector<bool> has_lower(size(), false);
+        for (size_t v = 0; v < hasse.vertex_count(); ++v) {
+            for (size_t w : hasse.neighbors(v)) {
+                has_lower[w] = true;
+            }
+        }
+        return select(has_lower, false);
+    }
+
+    /**
+     * @brief Максимальные элементы (не имеющие строгих верхних граней)
+     */
+    set_type maximal_elements() const {
+        const RelationGraph& hasse = hasse_diagram();
+        std::vector<bool> has_upper(size(), false);
+        for (size_t v = 0; v < hasse.vertex_count(); ++v) {
+            has_upper[v] = !hasse.neighbors(v).empty();
+        }
+        return select(has_upper, false);
+    }
+
+    /**
+     * @brief Ширина: наибольший размер антицепи
+     *
+     * По теореме Дилуорса равна минимальному числу цепей, покрывающих множество.
+     */
+    size_t width() const {
+        return chains().size();
+    }
+
+    /**
+     * @brief Разбиение на минимальное число цепей
+     *
+     * Минимальное покрытие цепями равно |A| - ν, где ν - максимальное
+     * паросочетание в двудольном графе {(u, w') | u < w}; цепи восстанавливаются
+     * по рёбрам паросочетания. Каждая цепь упорядочена по возрастанию.
+     */
+    std::vector<std::vector<T>> chain_decomposition() const {
+        const auto& elements = relation_.indexed_elements();
+        std::vector<std::vector<T>> result;
+        result.reserve(chains().size());
+        for (const auto& chain : chains()) {
+            std::vector<T> values;
+            values.reserve(chain.size());
+            for (size_t v : chain) {
+                values.push_back(elements[v]);
+            }
+            result.push_back(std::move(values));
+        }
+        return result;
+    }
+
+private:
+    static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Алгоритм Кана по строгим дугам отношения порядка
+     *
+     * @throws std::logic_error если строгая часть отношения содержит цикл
+     */
+    std::vector<size_t> compute_topological_order() const {
+        const size_t n = size();
+        const RelationGraph& order = relation_.graph();
+
+        std::vector<size_t> in_degree(n, 0);
+        for (size_t v = 0; v < n; ++v) {
+            for (size_t w : order.neighbors(v)) {
+                if (w != v) {
+                    ++in_degree[w];
+                }
+            }
+        }
+
+        std::vector<size_t> result;
+        result.reserve(n);
+        for (size_t v = 0; v < n; ++v) {
+            if (in_degree[v] == 0) {
+                result.push_back(v);
+            }
+        }
+        // result используется как очередь: head - первый необработанный элемент
+        for (size_t head = 0; head < result.size(); ++head) {
+            const size_t v = result[head];
+            for (size_t w : order.neighbors(v)) {
+                if (w != v && --in_degree[w] == 0) {
+                    result.push_back(w);
+                }
+            }
+        }
+
+        if (result.size() != n) {
+            throw std::logic_error("Order relation contains a cycle");
+        }
+        return result;
+    }
+
+    set_type select(const std::vector<bool>& flags, bool value) const {
+        const auto& elements = relation_.indexed_elements();
+        std::vector<T> values;
+        for (size_t v = 0; v < elements.size(); ++v) {
+            if (flags[v] == value) {
+                values.push_back(elements[v]);
+            }
+        }
+        return set_type(values.begin(), values.end());
+    }
+
+    const std::vector<std::vector<size_t>>& chains() const {
+        if (!chains_.has_value()) {
+            const size_t n = size();
+            std::vector<size_t> match_left(n, none);
+            std::vector<size_t> match_right(n, none);
+            maximum_matching(match_left, match_right);
+
+            std::vector<std::vector<size_t>> result;
+            for (size_t v = 0; v < n; ++v) {
+                if (match_right[v] != none) {
+                    continue; // v не начало цепи
+                }
+                std::vector<size_t> chain;
+                for (size_t u = v; u != none; u = match_left[u]) {
+                    chain.push_back(u);
+                }
+                result.push_back(std::move(chain));
+            }
+            chains_ = std::move(result);
+        }
+        return *chains_;
+    }
+
+    /**
+     * @brief Максимальное паросочетание Хопкрофта–Карпа в графе {(u, w) | u < w}
+     *
+     * Каждая фаза ищет поиском в ширину слои кратчайших увеличивающих путей и
+     * затем находит максимальное множество непересекающихся путей поиском в
+     * глубину; фаз O(√|A|). Поиск в глубину итеративный, так как длина пути
+     * в длинных цепях может достигать |A|.
+     */
+    void maximum_matching(std::vector<size_t>& match_left, std::vector<size_t>& match_right) const {
+        const size_t n = size();
+        const RelationGraph& order = relation_.graph();
+        std::vector<size_t> distance(n);
+        std::vector<size_t> next_edge(n);
+        std::vector<size_t> queue;
+        std::vector<size_t> stack;
+
+        while (true) {
+            // Поиск в ширину от свободных вершин левой доли
+            queue.clear();
+            for (size_t u = 0; u < n; ++u) {
+                distance[u] = match_left[u] == none ? 0 : none;
+                if (match_left[u] == none) {
+                    queue.push_back(u);
+                }
+            }
+            size_t free_distance = none; // Длина кратчайшего увеличивающего пути
+            for (size_t head = 0; head < queue.size(); ++head) {
+                const size_t u = queue[head];
+                if (distance[u] >= free_distance) {
+                    continue;
+                }
+                for (size_t w : order.neighbors(u)) {
+                    if (w == u) {
+                        continue;
+                    }
+                    const size_t partner = match_right[w];
+                    if (partner == none) {
+                        if (free_distance == none) {
+                            free_distance = distance[u] + 1;
+                        }
+                    } else if (distance[partner] == none) {
+                        distance[partner] = distance[u] + 1;
+                        queue.push_back(partner);
+                    }
+                }
+            }
+            if (free_distance == none) {
+                return;
+            }
+
+            // Поиск в глубину по слоям; next_edge[u] - следующий соседний элемент u
+            for (size_t u = 0; u < n; ++u) {
+                next_edge[u] = 0;
+            }
+            for (size_t root = 0; root < n; ++root) {
+                if (match_left[root] != none) {
+                    continue;
+                }
+                stack.assign(1, root);
+                while (!stack.empty()) {
+                    const size_t u = stack.back();
+                    auto adjacent = order.neighbors(u);
+                    if (next_edge[u] == adjacent.size()) {
+                        distance[u] = none; // Из u увеличивающих путей больше нет
+                        stack.pop_back();
+                        if (!stack.empty()) {
+                            ++next_edge[stack.back()];
+                        }
+                        continue;
+                    }
+
+                    const size_t w = adjacent[next_edge[u]];
+                    const size_t partner = match_right[w];
+                    if (w != u && partner == none && distance[u] + 1 == free_distance) {
+                        // Найден путь: чередуем рёбра вдоль стека
+                        for (size_t v : stack) {
+                            const size_t target = order.neighbors(v)[next_edge[v]];
+                            match_left[v] = target;
+                            match_right[target] = v;
+                        }
+                        break;
+                    }
+                    if (w != u && partner != none && distance[partner] == distance[u] + 1) {
+                        stack.push_back(partner);
+                    } else {
+                        ++next_edge[u];
+                    }
+                }
+            }
+        }
+    }
+
+    relation_type relation_;
+    std::vector<size_t> topological_order_;                  // Индексы в порядке линейного расширения
+    mutable std::optional<RelationGraph> hasse_;             // Лениво построенная диаграмма Хассе
+    mutable std::optional<std::vector<std::vector<size_t>>> chains_; // Минимальное покрытие цепями
+};
+
+} // namespace cryptomath
@@ -1,10 +1,17 @@
 #pragma once
 
 #include "set.hpp"
+#include "bit_matrix.hpp"
+#include "relation_graph.hpp"
+#include "disjoint_set.hpp"
+#include "equivalence_partition.hpp"
 #include <set>
 #include <vector>
-#include <map>
-#include <functional>
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <concepts>
+#include <stdexcept>
 
 namespace cryptomath {
 
@@ -12,6 +19,17 @@ namespace cryptomath {
  * @brief Бинарное отношение на множестве
  * 
  * Представляет бинарное отношение R ⊆ A × A на множестве A.
+ * 
+ * Помимо множества пар отношение лениво строит одно из двух представлений над
+ * индексами элементов A, на котором выполняются проверки свойств и транзитивное
+ * замыкание:
+ * - плотную битовую матрицу (BitMatrix) для отношений с большим числом пар;
+ * - разреженный орграф (RelationGraph), если |R| < |A|² / 64, то есть пар меньше,
+ *   чем бит в одном слове строки матрицы на элемент.
+ *
+ * Представления и классы эквивалентности кэшируются в mutable-полях при первом
+ * вызове константных методов, поэтому одновременные вызовы константных методов
+ * одного объекта из разных потоков требуют внешней синхронизации.
  */
 template<typename T>
 class Relation {
@@ -24,7 +42,7 @@ public:
      * @brief Построить отношение из множества и пар отношения
      */
     Relation(const set_type& set, const Set<pair_type>& pairs)
-        : set_(set), pairs_(pairs) {
+        : set_(set), pairs_(pairs), indexed_elements_(set.begin(), set.end()) {
         // Проверяем, что все пары из множества × множество
         for (const auto& [a, b] : pairs_) {
             if (!set_.contains(a) || !set_.contains(b)) {
@@ -35,9 +53,14 @@ public:
 
     /**
      * @brief Построить отношение из предикатной функции
+     * 
+     * Предикат передаётся как параметр шаблона, поэтому его вызов встраивается
+     * в двойной цикл по A × A.
      */
-    Relation(const set_type& set, std::function<bool(const T&, const T&)> predicate)
-        : set_(set) {
+    template<typename Predicate>
+        requires std::predicate<const Predicate&, const T&, const T&>
+    Relation(const set_type& set, Predicate predicate)
+        : set_(set), indexed_elements_(set.begin(), set.end()) {
         for (const auto& a : set_) {
             for (const auto& b : set_) {
                 if (predicate(a, b)) {
@@ -71,14 +94,81 @@ public:
         return pairs_;
     }
 
+    /**
+     * @brief Получить элементы множества в порядке индексов битовой матрицы
+     */
+    const std::vector<T>& indexed_elements() const noexcept {
+        return indexed_elements_;
+    }
+
+    /**
+     * @brief Получить индекс элемента (номер строки и столбца в битовой матрице)
+     * 
+     * @throws std::domain_error если элемент не принадлежит множеству
+     */
+    size_t index_of(const T& a) const {
+        auto it = std::lower_bound(indexed_elements_.begin(), indexed_elements_.end(), a);
+        if (it == indexed_elements_.end() || a < *it) {
+            throw std::domain_error("Element not in relation set");
+        }
+        return static_cast<size_t>(it - indexed_elements_.begin());
+    }
+
+    /**
+     * @brief Получить отношение в виде плотной битовой матрицы
+     * 
+     * Матрица строится при первом обращении за O(|A|² / 64 + |R| log |A|)
+     * и затем переиспользуется (отношение неизменяемо).
+     */
+    const BitMatrix& bit_matrix() const {
+        if (!matrix_.has_value()) {
+            BitMatrix matrix(indexed_elements_.size(), indexed_elements_.size());
+            for_each_index_pair([&](size_t i, size_t j) {
+                matrix.set(i, j);
+            });
+            matrix_ = std::move(matrix);
+        }
+        return *matrix_;
+    }
+
+    /**
+     * @brief Получить отношение в виде разреженного орграфа над индексами элементов
+     * 
+     * Граф строится при первом обращении за O(|R| log |A|) и переиспользуется.
+     */
+    const RelationGraph& graph() const {
+        if (!graph_.has_value()) {
+            std::vector<std::pair<size_t, size_t>> edges;
+            edges.reserve(pairs_.size());
+            for_each_index_pair([&](size_t i, size_t j) {
+                edges.emplace_back(i, j);
+            });
+            graph_ = RelationGraph(indexed_elements_.size(), std::move(edges));
+        }
+        return *graph_;
+    }
+
+    /**
+     * @brief Проверить, разрежено ли отношение (используется графовое представление)
+     */
+    bool is_sparse() const noexcept {
+        const size_t n = indexed_elements_.size();
+        return pairs_.size() < n * n / BitMatrix::word_bits;
+    }
+
     /**
      * @brief Проверить, является ли отношение рефлексивным
      * 
-     * Отношение R является рефлексивным, если (a, a) ∈ R для всех a ∈ A
+     * Отношение R является рефлексивным, если (a, a) ∈ R для всех a ∈ A.
+     * Проверяется диагональ битовой матрицы.
      */
     bool is_reflexive() const {
-        for (const auto& a : set_) {
-            if (!related(a, a)) {
+        if (is_sparse()) {
+            return graph().is_reflexive();
+        }
+        const BitMatrix& m = bit_matrix();
+        for (size_t i = 0; i < m.rows(); ++i) {
+            if (!m.test(i, i)) {
                 return false;
             }
         }
@@ -88,15 +178,15 @@ public:
     /**
      * @brief Проверить, является ли отношение симметричным
      * 
-     * Отношение R является симметричным, если (a, b) ∈ R влечет (b, a) ∈ R
+     * Отношение R является симметричным, если (a, b) ∈ R влечет (b, a) ∈ R.
+     * Эквивалентно равенству матрицы и её транспонированной.
      */
     bool is_symmetric() const {
-        for (const auto& [a, b] : pairs_) {
-            if (!related(b, a)) {
-                return false;
-            }
+        if (is_sparse()) {
+            return graph().is_symmetric();
         }
-        return true;
+        const BitMatrix& m = bit_matrix();
+        return m == m.transpose();
     }
 
     /**
@@ -105,8 +195,18 @@ public:
      * Отношение R является антисимметричным, если (a, b) ∈ R и (b, a) ∈ R влечет a = b
      */
     bool is_antisymmetric() const {
-        for (const auto& [a, b] : pairs_) {
-            if (related(b, a) && a != b) {
+        if (is_sparse()) {
+            return graph().is_antisymmetric();
+        }
+        const BitMatrix& m = bit_matrix();
+        for (size_t i = 0; i < m.rows(); ++i) {
+            bool antisymmetric = true;
+            m.for_each_in_row(i, [&](size_t j) {
+                if (j != i && m.test(j, i)) {
+                    antisymmetric = false;
+                }
+            });
+            if (!antisymmetric) {
                 return false;
             }
         }
@@ -116,14 +216,25 @@ public:
     /**
      * @brief Проверить, является ли отношение транзитивным
      * 
-     * Отношение R является транзитивным, если (a, b) ∈ R и (b, c) ∈ R влечет (a, c) ∈ R
+     * Отношение R является транзитивным, если (a, b) ∈ R и (b, c) ∈ R влечет (a, c) ∈ R.
+     * Эквивалентно: для каждой пары (i, j) строка j содержится в строке i,
+     * что проверяется пословно за O(|R| · |A| / 64). Для разреженных отношений
+     * проверяются только соседи: O(|R| · средняя степень).
      */
     bool is_transitive() const {
-        for (const auto& [a, b] : pairs_) {
-            for (const auto& c : set_) {
-                if (related(b, c) && !related(a, c)) {
-                    return false;
+        if (is_sparse()) {
+            return graph().is_transitive();
+        }
+        const BitMatrix& m = bit_matrix();
+        for (size_t i = 0; i < m.rows(); ++i) {
+            bool transitive = true;
+            m.for_each_in_row(i, [&](size_t j) {
+                if (transitive && !m.row_subset_of(j, i)) {
+                    transitive = false;
                 }
+            });
+            if (!transitive) {
+                return false;
             }
         }
         return true;
@@ -148,53 +259,60 @@ public:
     }
 
     /**
-     * @brief Получить классы эквивалентности для отношения эквивалентности
+     * @brief Получить разбиение множества на классы эквивалентности
      * 
-     * @throws std::logic_error если отношение не является отношением эквивалентности
+     * Классы строятся одним проходом по парам с объединением в системе
+     * непересекающихся множеств: O(|R| α(|A|)) после индексации. Разбиение
+     * строится один раз и переиспользуется методами equivalence_classes,
+     * equivalence_class и quotient_set.
+     * 
+     * @param assume_equivalence Не проверять, что отношение является отношением
+     *        эквивалентности. Для произвольного отношения результатом будут классы
+     *        его эквивалентного замыкания (компоненты связности графа отношения).
+     * @throws std::logic_error если проверка включена и отношение не является
+     *         отношением эквивалентности
      */
-    Set<set_type> equivalence_classes() const {
-        if (!is_equivalence_relation()) {
-            throw std::logic_error("Relation must be an equivalence relation");
-        }
-
-        Set<set_type> classes;
-        std::map<T, bool> processed;
-
-        for (const auto& a : set_) {
-            if (processed[a]) {
-                continue;
+    const EquivalencePartition<T>& equivalence_partition(bool assume_equivalence = false) const {
+        if (!assume_equivalence && !equivalence_verified_) {
+            if (!is_equivalence_relation()) {
+                throw std::logic_error("Relation must be an equivalence relation");
             }
+            equivalence_verified_ = true;
+        }
 
-            set_type equivalence_class;
-            for (const auto& b : set_) {
-                if (related(a, b)) {
-                    equivalence_class.insert(b);
-                    processed[b] = true;
-                }
-            }
-            classes.insert(equivalence_class);
+        if (!partition_.has_value()) {
+            DisjointSetUnion classes(indexed_elements_.size());
+            for_each_index_pair([&](size_t i, size_t j) {
+                classes.unite(i, j);
+            });
+            const size_t count = classes.set_count();
+            partition_.emplace(indexed_elements_, classes.labels(), count);
         }
+        return *partition_;
+    }
 
-        return classes;
+    /**
+     * @brief Получить классы эквивалентности для отношения эквивалентности
+     * 
+     * @throws std::logic_error если отношение не является отношением эквивалентности
+     */
+    Set<set_type> equivalence_classes() const {
+        return equivalence_partition().to_set();
     }
 
     /**
      * @brief Получить класс эквивалентности конкретного элемента
      * 
+     * Для элемента вне множества возвращается пустое множество.
+     * 
      * @throws std::logic_error если отношение не является отношением эквивалентности
      */
     set_type equivalence_class(const T& a) const {
-        if (!is_equivalence_relation()) {
-            throw std::logic_error("Relation must be an equivalence relation");
+        const EquivalencePartition<T>& partition = equivalence_partition();
+        if (!set_.contains(a)) {
+            return set_type{};
         }
-
-        set_type result;
-        for (const auto& b : set_) {
-            if (related(a, b)) {
-                result.insert(b);
-            }
-        }
-        return result;
+        return partition.class_set(partition.class_of(a));
     }
 
     /**
@@ -206,65 +324,134 @@ public:
 
     /**
      * @brief Транзитивное замыкание отношения
+     * 
+     * Как и прежде, результат включает рефлексивные пары (a, a).
+     * Плотные отношения замыкаются алгоритмом Уоршелла над строками битовой
+     * матрицы, разреженные - сжатием компонент сильной связности и распространением
+     * достижимости по ациклическому графу компонент.
      */
     Relation transitive_closure() const {
-        // Используем алгоритм Флойда-Уоршелла
-        std::map<std::pair<T, T>, bool> closure;
-        
-        // Инициализируем текущими парами
-        for (const auto& [a, b] : pairs_) {
-            closure[std::make_pair(a, b)] = true;
+        if (is_sparse()) {
+            std::vector<pair_type> pairs;
+            graph().for_each_closure_pair(true, [&](size_t i, size_t j) {
+                pairs.emplace_back(indexed_elements_[i], indexed_elements_[j]);
+            });
+            return from_sorted_pairs(pairs);
         }
-        
+
+        BitMatrix closure = bit_matrix();
+
         // Добавляем рефлексивные пары
-        for (const auto& a : set_) {
-            closure[std::make_pair(a, a)] = true;
+        for (size_t i = 0; i < closure.rows(); ++i) {
+            closure.set(i, i);
         }
 
-        // Floyd-Warshall
-        for (const auto& k : set_) {
-            for (const auto& i : set_) {
-                for (const auto& j : set_) {
-                    auto ik = std::make_pair(i, k);
-                    auto kj = std::make_pair(k, j);
-                    auto ij = std::make_pair(i, j);
-                    
-                    if (closure.find(ik) != closure.end() && 
-                        closure.find(kj) != closure.end()) {
-                        closure[ij] = true;
-                    }
-                }
-            }
+        closure.transitive_closure_inplace();
+        return from_bit_matrix(closure);
+    }
+
+    /**
+     * @brief Рефлексивно-транзитивное замыкание R* = ∪ₖ Rᵏ (k ≥ 0)
+     * 
+     * Вычисляется возведением в квадрат матрицы I ∪ R до стабилизации:
+     * не более ⌈log₂ |A|⌉ булевых произведений. Для разреженных отношений
+     * используется то же сжатие компонент, что и в transitive_closure.
+     *
+     * @param thread_count Число потоков для каждого произведения
+     *        (BitMatrix::multiply_parallel); по умолчанию 1 - без потоков,
+     *        0 - по числу аппаратных потоков
+     */
+    Relation reflexive_transitive_closure(size_t thread_count = 1) const {
+        if (is_sparse()) {
+            return transitive_closure();
         }
 
-        Set<pair_type> closure_pairs;
-        for (const auto& [pair, value] : closure) {
-            if (value) {
-                closure_pairs.insert(pair);
+        BitMatrix closure = bit_matrix();
+        for (size_t i = 0; i < closure.rows(); ++i) {
+            closure.set(i, i);
+        }
+        while (true) {
+            BitMatrix squared = multiply(closure, closure, thread_count);
+            if (squared == closure) {
+                break;
             }
+            closure = std::move(squared);
         }
-
-        return Relation(set_, closure_pairs);
+        return from_bit_matrix(std::move(closure));
     }
 
     /**
      * @brief Композиция отношений: R ∘ S = {(a, c) | ∃b: (a, b) ∈ S и (b, c) ∈ R}
+     * 
+     * В матричной форме M(R ∘ S) = M(S) · M(R) (булево произведение). Если оба
+     * отношения разрежены, пары соединяются по спискам смежности без построения
+     * матриц: O(Σ_(a,b)∈S deg_R(b)) плюс сортировка результата.
+     * 
+     * @param thread_count Число потоков для матричного произведения (см.
+     *        reflexive_transitive_closure); по умолчанию 1 - без потоков
+     * @throws std::domain_error если отношения заданы на разных множествах
      */
-    Relation compose(const Relation& other) const {
+    Relation compose(const Relation& other, size_t thread_count = 1) const {
         if (set_ != other.set_) {
             throw std::domain_error("Relations must be on the same set");
         }
 
-        Set<pair_type> composed_pairs;
-        for (const auto& [a, b] : other.pairs_) {
-            for (const auto& c : set_) {
-                if (related(b, c)) {
-                    composed_pairs.insert(std::make_pair(a, c));
+        if (is_sparse() && other.is_sparse()) {
+            const RelationGraph& first = other.graph();
+            const RelationGraph& second = graph();
+            std::vector<std::pair<size_t, size_t>> indices;
+            for (size_t a = 0; a < first.vertex_count(); ++a) {
+                const size_t row_start = indices.size();
+                for (size_t b : first.neighbors(a)) {
+                    for (size_t c : second.neighbors(b)) {
+                        indices.emplace_back(a, c);
+                    }
                 }
+                std::sort(indices.begin() + static_cast<std::ptrdiff_t>(row_start), indices.end());
+                indices.erase(std::unique(indices.begin() + static_cast<std::ptrdiff_t>(row_start),
+                                          indices.end()),
+                              indices.end());
+            }
+
+            std::vector<pair_type> pairs;
+            pairs.reserve(indices.size());
+            for (const auto& [a, c] : indices) {
+                pairs.emplace_back(indexed_elements_[a], indexed_elements_[c]);
+            }
+            return from_sorted_pairs(pairs);
+        }
+
+        return from_bit_matrix(multiply(other.bit_matrix(), bit_matrix(), thread_count));
+    }
+
+    /**
+     * @brief Степень отношения: R⁰ - отношение равенства, Rᵏ = R ∘ Rᵏ⁻¹
+     * 
+     * Вычисляется двоичным возведением в степень, то есть за O(log k) композиций.
+     */
+    Relation power(size_t k) const {
+        if (k == 0) {
+            std::vector<pair_type> diagonal;
+            diagonal.reserve(indexed_elements_.size());
+            for (const auto& a : indexed_elements_) {
+                diagonal.emplace_back(a, a);
             }
+            return from_sorted_pairs(diagonal);
         }
 
-        return Relation(set_, composed_pairs);
+        std::optional<Relation> result;
+        Relation base = *this;
+        while (true) {
+            if (k & 1) {
+                result = result.has_value() ? result->compose(base) : base;
+            }
+            k >>= 1;
+            if (k == 0) {
+                break;
+            }
+            base = base.compose(base);
+        }
+        return *result;
     }
 
     /**
@@ -282,8 +469,66 @@ public:
     }
 
 private:
+    /**
+     * @brief Булево произведение: в вызывающем потоке при thread_count = 1
+     */
+    static BitMatrix multiply(const BitMatrix& a, const BitMatrix& b, size_t thread_count) {
+        return thread_count == 1 ? a.multiply(b) : a.multiply_parallel(b, thread_count);
+    }
+
+    /**
+     * @brief Вызвать f(i, j) для индексов каждой пары отношения
+     * 
+     * Пары упорядочены по первому элементу, поэтому его индекс только растёт
+     * и ищется линейным проходом; индекс второго элемента ищется двоичным поиском.
+     */
+    template<typename F>
+    void for_each_index_pair(F f) const {
+        size_t row = 0;
+        for (const auto& [a, b] : pairs_) {
+            while (indexed_elements_[row] < a) {
+                ++row;
+            }
+            f(row, index_of(b));
+        }
+    }
+
+    /**
+     * @brief Построить отношение на том же множестве из битовой матрицы
+     * 
+     * Пары порождаются в лексикографическом порядке, поэтому множество пар
+     * собирается за линейное время и не требует повторной проверки.
+     */
+    Relation from_bit_matrix(BitMatrix matrix) const {
+        std::vector<pair_type> pairs;
+        pairs.reserve(matrix.count());
+        for (size_t i = 0; i < matrix.rows(); ++i) {
+            matrix.for_each_in_row(i, [&](size_t j) {
+                pairs.emplace_back(indexed_elements_[i], indexed_elements_[j]);
+            });
+        }
+
+        Relation result = from_sorted_pairs(pairs);
+        result.matrix_ = std::move(matrix);
+        return result;
+    }
+
+    /**
+     * @brief Построить отношение на том же множестве из упорядоченных пар его элементов
+     */
+    Relation from_sorted_pairs(const std::vector<pair_type>& pairs) const {
+        Relation result(set_, Set<pair_type>{});
+        result.pairs_ = Set<pair_type>(pairs.begin(), pairs.end());
+        return result;
+    }
+
     set_type set_;
     Set<pair_type> pairs_;
+    std::vector<T> indexed_elements_;       // Элементы A в порядке индексов матрицы
+    mutable std::optional<BitMatrix> matrix_; // Лениво построенная битовая матрица
+    mutable std::optional<RelationGraph> graph_; // Лениво построенный разреженный граф
+    mutable std::optional<EquivalencePartition<T>> partition_; // Лениво построенные классы
+    mutable bool equivalence_verified_ = false; // Свойства эквивалентности уже проверены
 };
 
 } // namespace cryptomath
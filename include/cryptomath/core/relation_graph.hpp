@@ -0,0 +1,274 @@
+#pragma once
+
+#include "bit_matrix.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Разбиение вершин графа на компоненты сильной связности
+ *
+ * Компоненты пронумерованы в обратном топологическом порядке (как их выдаёт
+ * алгоритм Тарьяна): если есть дуга из компоненты a в компоненту b ≠ a, то b < a.
+ */
+struct StronglyConnectedComponents {
+    std::vector<size_t> component; // component[v] - номер компоненты вершины v
+    size_t count = 0;              // Число компонент
+};
+
+/**
+ * @brief Разреженное представление бинарного отношения в виде орграфа (CSR)
+ *
+ * Вершины - индексы элементов множества, дуги - пары отношения. Списки смежности
+ * хранятся подряд в одном массиве и отсортированы, поэтому проверка дуги - это
+ * двоичный поиск в списке соседей. Предназначено для отношений с небольшим числом
+ * пар на элемент, где плотная матрица |A|² бит неприемлема.
+ */
+class RelationGraph {
+public:
+    RelationGraph() = default;
+
+    /**
+     * @brief Построить граф из списка дуг (u, v), 0 ≤ u, v < vertex_count
+     *
+     * Повторяющиеся дуги удаляются.
+     */
+    RelationGraph(size_t vertex_count, std::vector<std::pair<size_t, size_t>> edges)
+        : offsets_(vertex_count + 1, 0) {
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+        targets_.reserve(edges.size());
+        for (const auto& [u, v] : edges) {
+            ++offsets_[u + 1];
+            targets_.push_back(v);
+        }
+        for (size_t v = 0; v < vertex_count; ++v) {
+            offsets_[v + 1] += offsets_[v];
+        }
+    }
+
+    size_t vertex_count() const noexcept {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    size_t edge_count() const noexcept {
+        return targets_.size();
+    }
+
+    /**
+     * @brief Отсортированный список соседей вершины v
+     */
+    std::span<const size_t> neighbors(size_t v) const noexcept {
+        return {targets_.data() + offsets_[v], offsets_[v + 1] - offsets_[v]};
+    }
+
+    /**
+     * @brief Проверить наличие дуги (u, v) за O(log deg(u))
+     */
+    bool has_edge(size_t u, size_t v) const noexcept {
+        auto adjacent = neighbors(u);
+        return std::binary_search(adjacent.begin(), adjacent.end(), v);
+    }
+
+    bool is_reflexive() const noexcept {
+        for (size_t v = 0; v < vertex_count(); ++v) {
+            if (!has_edge(v, v)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool is_symmetric() const noexcept {
+        for (size_t u = 0; u < vertex_count(); ++u) {
+            for (size_t v : neighbors(u)) {
+                if (!has_edge(v, u)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool is_antisymmetric() const noexcept {
+        for (size_t u = 0; u < vertex_count(); ++u) {
+            for (size_t v : neighbors(u)) {
+                if (u != v && has_edge(v, u)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Проверить транзитивность: (u, v), (v, w) ⇒ (u, w)
+     *
+     * Для каждой дуги (u, v) проверяются только соседи v, то есть
+     * O(|E| · средняя степень · log(степень)) операций.
+     */
+    bool is_transitive() const noexcept {
+        for (size_t u = 0; u < vertex_count(); ++u) {
+            for (size_t v : neighbors(u)) {
+                for (size_t w : neighbors(v)) {
+                    if (!has_edge(u, w)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Компоненты сильной связности (итеративный алгоритм Тарьяна)
+     *
+     * Итеративная форма не ограничена глубиной стека вызовов, что важно для
+     * длинных цепочек на множествах из 10⁵ и более элементов.
+     */
+    StronglyConnectedComponents strongly_connected_components() const {
+        constexpr size_t unvisited = std::numeric_limits<size_t>::max();
+        const size_t n = vertex_count();
+
+        StronglyConnectedComponents result;
+        result.component.assign(n, unvisited);
+
+        std::vector<size_t> order(n, unvisited);
+        std::vector<size_t> low(n, 0);
+        std::vector<bool> on_stack(n, false);
+        std::vector<size_t> stack;
+        std::vector<std::pair<size_t, size_t>> calls; // (вершина, позиция следующей дуги)
+        size_t counter = 0;
+
+        for (size_t root = 0; root < n; ++root) {
+            if (order[root] != unvisited) {
+                continue;
+            }
+
+            order[root] = low[root] = counter++;
+            stack.push_back(root);
+            on_stack[root] = true;
+            calls.emplace_back(root, offsets_[root]);
+
+            while (!calls.empty()) {
+                const size_t v = calls.back().first;
+                size_t& position = calls.back().second;
+
+                if (position < offsets_[v + 1]) {
+                    const size_t w = targets_[position++];
+                    if (order[w] == unvisited) {
+                        order[w] = low[w] = counter++;
+                        stack.push_back(w);
+                        on_stack[w] = true;
+                        calls.emplace_back(w, offsets_[w]);
+                    } else if (on_stack[w]) {
+                        low[v] = std::min(low[v], order[w]);
+                    }
+                    continue;
+                }
+
+                // Все дуги v обработаны: v - корень компоненты, если low[v] = order[v]
+                if (low[v] == order[v]) {
+                    size_t w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        on_stack[w] = false;
+                        result.component[w] = result.count;
+                    } while (w != v);
+                    ++result.count;
+                }
+
+                calls.pop_back();
+                if (!calls.empty()) {
+                    const size_t parent = calls.back().first;
+                    low[parent] = std::min(low[parent], low[v]);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Перечислить пары транзитивного замыкания в лексикографическом порядке
+     *
+     * Граф сжимается по компонентам сильной связности, после чего достижимость
+     * на ациклическом графе компонент вычисляется распространением битовых строк
+     * (компоненты обрабатываются в обратном топологическом порядке, поэтому строки
+     * всех последователей уже готовы). Затраты: O(|E| · C / 64) на достижимость
+     * для C компонент плюс размер результата.
+     *
+     * @param reflexive Добавлять ли пары (v, v) для всех вершин
+     * @param f Вызывается как f(u, v) для каждой пары замыкания
+     */
+    template<typename F>
+    void for_each_closure_pair(bool reflexive, F f) const {
+        const size_t n = vertex_count();
+        const StronglyConnectedComponents scc = strongly_connected_components();
+
+        // Вершины каждой компоненты подряд (CSR) в порядке возрастания
+        std::vector<size_t> component_offsets(scc.count + 1, 0);
+        for (size_t v = 0; v < n; ++v) {
+            ++component_offsets[scc.component[v] + 1];
+        }
+        for (size_t c = 0; c < scc.count; ++c) {
+            component_offsets[c + 1] += component_offsets[c];
+        }
+        std::vector<size_t> component_vertices(n);
+        {
+            std::vector<size_t> fill(component_offsets.begin(), component_offsets.end() - 1);
+            for (size_t v = 0; v < n; ++v) {
+                component_vertices[fill[scc.component[v]]++] = v;
+            }
+        }
+
+        // reach[c] - множество компонент, достижимых из c
+        BitMatrix reach(scc.count, scc.count);
+        for (size_t c = 0; c < scc.count; ++c) {
+            const size_t first = component_offsets[c];
+            const size_t last = component_offsets[c + 1];
+            if (reflexive || last - first > 1) {
+                reach.set(c, c);
+            }
+            for (size_t k = first; k < last; ++k) {
+                const size_t v = component_vertices[k];
+                for (size_t w : neighbors(v)) {
+                    const size_t d = scc.component[w];
+                    if (d == c) {
+                        reach.set(c, c); // Петля или дуга внутри компоненты
+                    } else if (!reach.test(c, d)) {
+                        reach.set(c, d);
+                        reach.or_row(c, d);
+                    }
+                }
+            }
+        }
+
+        // Переводим строки компонент в упорядоченные строки вершин
+        BitMatrix row(1, n);
+        for (size_t u = 0; u < n; ++u) {
+            reach.for_each_in_row(scc.component[u], [&](size_t d) {
+                for (size_t k = component_offsets[d]; k < component_offsets[d + 1]; ++k) {
+                    row.set(0, component_vertices[k]);
+                }
+            });
+            row.for_each_in_row(0, [&](size_t v) {
+                f(u, v);
+            });
+            row.clear_row(0);
+        }
+    }
+
+private:
+    std::vector<size_t> offsets_; // Начало списка соседей каждой вершины
+    std::vector<size_t> targets_; // Конкатенация отсортированных списков соседей
+};
+
+} // namespace cryptomath
@@ -2,6 +2,7 @@
 
 #include "groupoid.hpp"
 #include "concepts.hpp"
+#include "exponentiation.hpp"
 #include <concepts>
 
 namespace cryptomath {
@@ -50,10 +51,16 @@ public:
             throw std::invalid_argument("Empty product is not defined in semigroup");
         }
 
+        if (!this->elements_.contains(*first)) {
+            throw std::domain_error("Elements not in groupoid");
+        }
         T result = *first;
         ++first;
         while (first != last) {
-            result = this->operate(result, *first);
+            if (!this->elements_.contains(*first)) {
+                throw std::domain_error("Elements not in groupoid");
+            }
+            result = this->operate_unchecked(result, *first);
             ++first;
         }
         return result;
@@ -61,30 +68,20 @@ public:
 
     /**
      * @brief Вычислить степень элемента: a^n = a ∘ a ∘ ... ∘ a (n раз)
+     * 
+     * Использует возведение скользящим окном (см. detail::sliding_window_power).
      */
     T power(const T& a, size_t n) const {
         if (n == 0) {
             throw std::invalid_argument("Zero power not defined in semigroup");
         }
-
-        if (n == 1) {
-            return a;
+        if (!this->elements_.contains(a)) {
+            throw std::domain_error("Elements not in groupoid");
         }
 
-        // Используем бинарное возведение в степень для эффективности
-        T result = a;
-        size_t exp = n - 1;
-        T current_power = a;
-
-        while (exp > 0) {
-            if (exp % 2 == 1) {
-                result = this->operate(result, current_power);
-            }
-            current_power = this->operate(current_power, current_power);
-            exp /= 2;
-        }
-
-        return result;
+        return detail::sliding_window_power(a, n, [this](const T& x, const T& y) {
+            return this->operate_unchecked(x, y);
+        });
     }
 
     /**
@@ -103,8 +100,8 @@ public:
         for (const auto& candidate : this->elements_) {
             bool is_identity = true;
             for (const auto& a : this->elements_) {
-                if (this->operate(candidate, a) != a ||
-                    this->operate(a, candidate) != a) {
+                if (this->operate_unchecked(candidate, a) != a ||
+                    this->operate_unchecked(a, candidate) != a) {
                     is_identity = false;
                     break;
                 }
@@ -126,8 +123,8 @@ public:
         for (const auto& candidate : this->elements_) {
             bool is_identity = true;
             for (const auto& a : this->elements_) {
-                if (this->operate(candidate, a) != a ||
-                    this->operate(a, candidate) != a) {
+                if (this->operate_unchecked(candidate, a) != a ||
+                    this->operate_unchecked(a, candidate) != a) {
                     is_identity = false;
                     break;
                 }
@@ -0,0 +1,335 @@
+#pragma once
+
+#include "permutation.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Цепочка стабилизаторов группы перестановок (алгоритм Шрайера–Симса)
+ *
+ * Группа G ≤ Sym(n) задаётся порождающими, а не списком элементов. Строится
+ * цепочка G = G⁽⁰⁾ ≥ G⁽¹⁾ ≥ ... ≥ G⁽ⁿ⁾ = 1, где G⁽ᵏ⁾ - поточечный стабилизатор
+ * точек 0, ..., k - 1, и для каждого уровня - трансверсаль орбиты точки k под
+ * действием G⁽ᵏ⁾. Порождающие всех уровней образуют сильную порождающую систему.
+ *
+ * После построения за полиномиальное от n время:
+ * - |G| = ∏ |орбита уровня k|;
+ * - принадлежность проверяется просеиванием через уровни за O(n²);
+ * - равномерно случайный элемент - произведение случайных представителей трансверсалей.
+ * Так обрабатываются группы вроде S₂₀ или группы кубика Рубика, список элементов
+ * которых построить невозможно.
+ */
+class StabilizerChain {
+public:
+    using permutation_type = DynamicPermutation;
+
+    /**
+     * @brief Построить цепочку для группы, порождённой перестановками степени degree
+     *
+     * @throws std::invalid_argument если степень порождающего отлична от degree
+     */
+    StabilizerChain(size_t degree, const std::vector<permutation_type>& generators)
+        : degree_(degree), levels_(degree) {
+        for (const auto& g : generators) {
+            if (g.degree() != degree_) {
+                throw std::invalid_argument("Generator degree does not match chain degree");
+            }
+        }
+        for (const auto& g : generators) {
+            if (!sifts_from(g, 0)) {
+                add_generator(g, 0);
+            }
+        }
+    }
+
+    /**
+     * @brief Построить цепочку по порождающим фиксированной степени N
+     */
+    template<size_t N>
+    explicit StabilizerChain(const std::vector<Permutation<N>>& generators)
+        : StabilizerChain(N, to_dynamic(generators)) {}
+
+    /**
+     * @brief Степень (число переставляемых точек)
+     */
+    size_t degree() const noexcept {
+        return degree_;
+    }
+
+    /**
+     * @brief Порядок группы
+     *
+     * @throws std::overflow_error если порядок не помещается в size_t (см. order_string)
+     */
+    size_t order() const {
+        size_t result = 1;
+        for (const auto& level : levels_) {
+            const size_t orbit_size = level.orbit.empty() ? 1 : level.orbit.size();
+            if (result > std::numeric_limits<size_t>::max() / orbit_size) {
+                throw std::overflow_error("Group order does not fit in size_t");
+            }
+            result *= orbit_size;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Порядок группы (тот же, что у order(); для совместимости с Subgroup::size)
+     */
+    size_t size() const {
+        return order();
+    }
+
+    /**
+     * @brief Порядок группы в десятичной записи (без ограничения разрядности)
+     */
+    std::string order_string() const {
+        // Число в системе счисления 10⁹, младшие разряды первыми
+        constexpr std::uint64_t radix = 1'000'000'000;
+        std::vector<std::uint64_t> digits{1};
+        for (const auto& level : levels_) {
+            const std::uint64_t factor = level.orbit.empty() ? 1 : level.orbit.size();
+            std::uint64_t carry = 0;
+            for (auto& digit : digits) {
+                const std::uint64_t value = digit * factor + carry;
+                digit = value % radix;
+                carry = value / radix;
+            }
+            while (carry != 0) {
+                digits.push_back(carry % radix);
+                carry /= radix;
+            }
+        }
+
+        std::string result = std::to_string(digits.back());
+        for (size_t k = digits.size() - 1; k-- > 0;) {
+            const std::string part = std::to_string(digits[k]);
+            result += std::string(9 - part.size(), '0') + part;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Проверить принадлежность перестановки группе (просеивание)
+     */
+    bool contains(const permutation_type& p) const {
+        return p.degree() == degree_ && sifts_from(p, 0);
+    }
+
+    /**
+     * @brief База: точки, стабилизаторы которых дают строгое убывание цепочки
+     */
+    std::vector<size_t> base() const {
+        std::vector<size_t> result;
+        for (size_t k = 0; k < degree_; ++k) {
+            if (levels_[k].orbit.size() > 1) {
+                result.push_back(k);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Длины базисных орбит (по точкам base())
+     */
+    std::vector<size_t> basic_orbit_sizes() const {
+        std::vector<size_t> result;
+        for (const auto& level : levels_) {
+            if (level.orbit.size() > 1) {
+                result.push_back(level.orbit.size());
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Сильная порождающая система (порождающие всех уровней)
+     */
+    std::vector<permutation_type> strong_generators() const {
+        std::vector<permutation_type> result;
+        for (const auto& level : levels_) {
+            result.insert(result.end(), level.generators.begin(), level.generators.end());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Равномерно распределённый случайный элемент группы
+     *
+     * Каждый элемент однозначно записывается как u₀ · u₁ · ... с uₖ из трансверсали
+     * уровня k, поэтому независимый равномерный выбор uₖ даёт равномерное распределение.
+     */
+    template<typename URBG>
+    permutation_type random_element(URBG& generator) const {
+        permutation_type result(degree_);
+        for (const auto& level : levels_) {
+            if (level.orbit.size() > 1) {
+                std::uniform_int_distribution<size_t> pick(0, level.orbit.size() - 1);
+                result = result * *level.transversal[level.orbit[pick(generator)]];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Проверить, что группа, заданная этой цепочкой, - подгруппа group
+     */
+    bool is_subgroup_of(const StabilizerChain& group) const {
+        if (group.degree_ != degree_) {
+            return false;
+        }
+        for (const auto& level : levels_) {
+            for (const auto& g : level.generators) {
+                if (!group.contains(g)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Индекс [G : H] этой подгруппы H в group по теореме Лагранжа
+     *
+     * @throws std::invalid_argument если группа не является подгруппой group
+     */
+    size_t index_in(const StabilizerChain& group) const {
+        if (!is_subgroup_of(group)) {
+            throw std::invalid_argument("Chain does not describe a subgroup of the given group");
+        }
+        return group.order() / order();
+    }
+
+private:
+    /**
+     * @brief Уровень k: G⁽ᵏ⁾ и трансверсаль орбиты точки k
+     *
+     * Трансверсаль заводится при добавлении первого порождающего; до этого
+     * орбита уровня тривиальна.
+     */
+    struct Level {
+        std::vector<permutation_type> generators;
+        std::vector<size_t> orbit;
+        std::vector<std::optional<permutation_type>> transversal;         // u(k) = точка
+        std::vector<std::optional<permutation_type>> inverse_transversal; // u⁻¹
+    };
+
+    template<size_t N>
+    static std::vector<permutation_type> to_dynamic(const std::vector<Permutation<N>>& generators) {
+        std::vector<permutation_type> result;
+        result.reserve(generators.size());
+        for (const auto& g : generators) {
+            result.emplace_back(g);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Проверить, что p ∈ G⁽ᵏ⁾, просеивая через уровни k, k + 1, ...
+     */
+    bool sifts_from(permutation_type p, size_t k) const {
+        for (size_t j = k; j < degree_; ++j) {
+            const size_t point = p(j);
+            const Level& level = levels_[j];
+            if (level.transversal.empty()) {
+                if (point != j) {
+                    return false;
+                }
+                continue;
+            }
+            if (!level.transversal[point].has_value()) {
+                return false;
+            }
+            p = *level.inverse_transversal[point] * p;
+        }
+        return true; // p фиксирует все точки
+    }
+
+    /**
+     * @brief Перестановка h ∈ G⁽ᵏ⁾, ожидающая учёта на уровне k
+     */
+    struct PendingExtension {
+        permutation_type h;
+        size_t level;
+    };
+
+    /**
+     * @brief Добавить порождающий g ∈ G⁽ᵏ⁾ \ ⟨текущих порождающих уровня k⟩
+     *
+     * Обновление итеративное: перестановки, которые нужно учесть, копятся в
+     * явном списке пар (перестановка, уровень). При рекурсии глубина росла бы
+     * как длина орбит, умноженная на длину цепочки.
+     */
+    void add_generator(const permutation_type& g, size_t k) {
+        std::vector<PendingExtension> pending;
+        append_generator(g, k, pending);
+        while (!pending.empty()) {
+            PendingExtension next = std::move(pending.back());
+            pending.pop_back();
+            extend(next.h, next.level, pending);
+        }
+    }
+
+    /**
+     * @brief Записать порождающий уровня k и поставить в очередь g · u_p для известных точек p
+     *
+     * Точки, добавленные в орбиту позже, учтут g при своём добавлении (extend),
+     * поэтому каждая пара (порождающий, точка орбиты) обрабатывается один раз.
+     */
+    void append_generator(const permutation_type& g, size_t k, std::vector<PendingExtension>& pending) {
+        Level& level = levels_[k];
+        if (level.transversal.empty()) {
+            level.transversal.resize(degree_);
+            level.inverse_transversal.resize(degree_);
+            level.transversal[k] = permutation_type(degree_);
+            level.inverse_transversal[k] = permutation_type(degree_);
+            level.orbit.push_back(k);
+        }
+
+        level.generators.push_back(g);
+        for (size_t p : level.orbit) {
+            pending.push_back({g * *level.transversal[p], k});
+        }
+    }
+
+    /**
+     * @brief Учесть перестановку h ∈ G⁽ᵏ⁾ с h(k) = q
+     *
+     * Новая точка орбиты получает представителя h, и в очередь ставятся s · h
+     * для порождающих s уровня; для известной точки шрайеровский порождающий
+     * u_q⁻¹ · h просеивается в G⁽ᵏ⁺¹⁾ и при неудаче добавляется туда.
+     * Успешное просеивание остаётся верным и дальше: трансверсали только растут.
+     */
+    void extend(const permutation_type& h, size_t k, std::vector<PendingExtension>& pending) {
+        Level& level = levels_[k];
+        const size_t q = h(k);
+
+        if (level.transversal[q].has_value()) {
+            permutation_type schreier = *level.inverse_transversal[q] * h;
+            if (!sifts_from(schreier, k + 1)) {
+                append_generator(schreier, k + 1, pending);
+            }
+            return;
+        }
+
+        level.transversal[q] = h;
+        level.inverse_transversal[q] = permutation_type::inverse(h);
+        level.orbit.push_back(q);
+        for (const auto& s : level.generators) {
+            pending.push_back({s * h, k});
+        }
+    }
+
+    size_t degree_;
+    std::vector<Level> levels_;
+};
+
+} // namespace cryptomath
@@ -1,12 +1,29 @@
 #pragma once
 
+#include "bit_matrix.hpp"
 #include "group.hpp"
 #include "set.hpp"
+#include <algorithm>
 #include <concepts>
+#include <optional>
+#include <vector>
 #include <stdexcept>
 
 namespace cryptomath {
 
+/**
+ * @brief Метка конструктора для подмножества, которое заведомо является подгруппой
+ * 
+ * Используется алгоритмами, которые строят подгруппу замыканием (ядро и образ
+ * гомоморфизма, подгруппа, порождённая элементами), чтобы не повторять проверку
+ * критерия подгруппы за O(|H|²).
+ */
+struct trusted_subgroup_t {
+    explicit trusted_subgroup_t() = default;
+};
+
+inline constexpr trusted_subgroup_t trusted_subgroup{};
+
 /**
  * @brief Подгруппа группы
  * 
@@ -20,6 +37,9 @@ namespace cryptomath {
  * Альтернативный критерий (для конечных групп):
  * 1. H непусто
  * 2. H замкнуто относительно операции
+ * 
+ * generators() заполняет кэш при первом вызове; одновременные обращения
+ * к одной подгруппе из разных потоков должны синхронизироваться вызывающим кодом.
  */
 template<typename T, typename Op>
     requires GroupConcept<T, Op>
@@ -45,6 +65,55 @@ public:
         }
     }
 
+    /**
+     * @brief Построить подгруппу без проверки критерия
+     * 
+     * Предусловие: subset является подгруппой parent_group.
+     */
+    Subgroup(const group_type& parent_group, const set_type& subset, trusted_subgroup_t)
+        : parent_group_(parent_group), subset_(subset) {}
+
+    /**
+     * @brief Подгруппа ⟨S⟩, порождённая элементами S
+     * 
+     * Строится алгоритмом Димино (detail::extend_closure): порождающие
+     * добавляются по одному, и подгруппа расширяется правыми смежными классами.
+     * Результат заведомо является подгруппой, поэтому критерий не проверяется;
+     * затраты - O(|⟨S⟩| · |S|) операций вместо O(|H|²) у конструктора.
+     * Элементы S, уже лежащие в подгруппе остальных, не попадают в generators().
+     * 
+     * @throws std::domain_error если элемент S не принадлежит группе
+     */
+    static Subgroup generated_by(const group_type& group, const std::vector<T>& elements) {
+        const size_t n = group.indexed_elements().size();
+        std::vector<bool> in_closure(n, false);
+        std::vector<size_t> closure{group.index_of(group.identity())};
+        in_closure[closure.front()] = true;
+
+        std::vector<size_t> generator_indices;
+        std::vector<T> generators;
+        for (const auto& x : elements) {
+            const size_t index = group.index_of(x);
+            if (in_closure[index]) {
+                continue;
+            }
+            generator_indices.push_back(index);
+            generators.push_back(x);
+            detail::extend_closure(group, in_closure, closure, generator_indices);
+        }
+
+        std::sort(closure.begin(), closure.end());
+        std::vector<T> values;
+        values.reserve(closure.size());
+        for (size_t i : closure) {
+            values.push_back(group.element_at(i));
+        }
+
+        Subgroup result(group, set_type(values.begin(), values.end()), trusted_subgroup);
+        result.generators_ = std::move(generators);
+        return result;
+    }
+
     /**
      * @brief Проверить критерий подгруппы
      * 
@@ -66,10 +135,11 @@ public:
         }
 
         // Проверяем критерий: для всех a, b ∈ H выполняется a ∘ b⁻¹ ∈ H
-        for (const auto& a : subset_) {
-            for (const auto& b : subset_) {
-                T b_inverse = parent_group_.inverse(b);
-                T product = parent_group_.operate(a, b_inverse);
+        // Обратный к b берётся из таблицы группы один раз на внешней итерации
+        for (const auto& b : subset_) {
+            T b_inverse = parent_group_.inverse(b);
+            for (const auto& a : subset_) {
+                T product = parent_group_.operate_unchecked(a, b_inverse);
                 if (!subset_.contains(product)) {
                     return false;
                 }
@@ -101,7 +171,7 @@ public:
         // Проверяем замкнутость
         for (const auto& a : subset_) {
             for (const auto& b : subset_) {
-                T product = parent_group_.operate(a, b);
+                T product = parent_group_.operate_unchecked(a, b);
                 if (!subset_.contains(product)) {
                     return false;
                 }
@@ -146,18 +216,72 @@ public:
         return subset_.size();
     }
 
+    /**
+     * @brief Порождающее множество подгруппы
+     * 
+     * Выбирается жадно при первом обращении, как в Group::generator_indices:
+     * элемент H, не лежащий в подгруппе, порождённой выбранными, добавляется,
+     * и подгруппа замыкается умножением на порождающие. Порождающих не больше
+     * log₂ |H|, работа - O(|H| · |порождающих|) операций.
+     */
+    const std::vector<T>& generators() const {
+        if (!generators_.has_value()) {
+            const size_t n = parent_group_.indexed_elements().size();
+            std::vector<size_t> generator_indices;
+            std::vector<bool> in_closure(n, false);
+            std::vector<size_t> closure{parent_group_.index_of(parent_group_.identity())};
+            in_closure[closure.front()] = true;
+
+            for (const auto& h : subset_) {
+                if (closure.size() == subset_.size()) {
+                    break;
+                }
+                const size_t candidate = parent_group_.index_of(h);
+                if (in_closure[candidate]) {
+                    continue;
+                }
+                generator_indices.push_back(candidate);
+                detail::extend_closure(parent_group_, in_closure, closure, generator_indices);
+            }
+
+            std::vector<T> result;
+            result.reserve(generator_indices.size());
+            for (size_t i : generator_indices) {
+                result.push_back(parent_group_.element_at(i));
+            }
+            generators_ = std::move(result);
+        }
+        return *generators_;
+    }
+
     /**
      * @brief Пересечение двух подгрупп
      * 
-     * Пересечение двух подгрупп также является подгруппой.
+     * Пересечение двух подгрупп также является подгруппой, поэтому критерий не
+     * проверяется. Подгруппы переводятся в битовые строки над индексами
+     * элементов группы, и пересечение - их пословное И.
      */
     static Subgroup intersection(const Subgroup& H1, const Subgroup& H2) {
-        if (&H1.parent_group_ != &H2.parent_group_) {
-            throw std::domain_error("Subgroups must be from the same parent group");
-        }
+        require_same_parent(H1, H2);
+        const group_type& group = H1.parent_group_;
 
-        set_type intersection_set = H1.subset_.intersection(H2.subset_);
-        return Subgroup(H1.parent_group_, intersection_set);
+        BitMatrix common = H1.index_row();
+        common.and_row(0, H2.index_row(), 0);
+        std::vector<T> values;
+        common.for_each_in_row(0, [&](size_t i) { values.push_back(group.element_at(i)); });
+        return Subgroup(group, set_type(values.begin(), values.end()), trusted_subgroup);
+    }
+
+    /**
+     * @brief Порядок произведения |H1 ∘ H2| = |H1| · |H2| / |H1 ∩ H2|
+     * 
+     * Вычисляется без построения произведения: мощность пересечения битовых строк.
+     */
+    static size_t product_size(const Subgroup& H1, const Subgroup& H2) {
+        require_same_parent(H1, H2);
+        BitMatrix common = H1.index_row();
+        common.and_row(0, H2.index_row(), 0);
+        return H1.size() * H2.size() / common.row_count(0);
     }
 
     /**
@@ -165,38 +289,51 @@ public:
      * 
      * Примечание: Произведение двух подгрупп не обязательно является подгруппой.
      * Оно является подгруппой тогда и только тогда, когда H1 ∘ H2 = H2 ∘ H1.
+     * 
+     * H1 ∘ H2 - объединение различных классов h1 ∘ H2, h1 ∈ H1; их
+     * [H1 : H1 ∩ H2] штук. Класс добавляется, только если h1 ещё не покрыт,
+     * поэтому выполняется |H1 ∘ H2| операций вместо |H1| · |H2|.
      */
     static set_type product(const Subgroup& H1, const Subgroup& H2) {
-        if (&H1.parent_group_ != &H2.parent_group_) {
-            throw std::domain_error("Subgroups must be from the same parent group");
-        }
+        require_same_parent(H1, H2);
+        const group_type& group = H1.parent_group_;
+        std::vector<size_t> indices = product_indices(H1, H2);
+        std::sort(indices.begin(), indices.end());
 
-        set_type product_set;
-        for (const auto& h1 : H1.subset_) {
-            for (const auto& h2 : H2.subset_) {
-                T product = H1.parent_group_.operate(h1, h2);
-                product_set.insert(product);
-            }
+        std::vector<T> values;
+        values.reserve(indices.size());
+        for (size_t i : indices) {
+            values.push_back(group.element_at(i));
         }
-
-        return product_set;
+        return set_type(values.begin(), values.end());
     }
 
     /**
      * @brief Check if product of two subgroups is a subgroup
+     * 
+     * H1 ∘ H2 содержит e и замкнуто справа умножением на H2. Если оно замкнуто
+     * и умножением на порождающие H1, то замкнуто умножением на ⟨H1, H2⟩ и
+     * совпадает с ней. Поэтому достаточно O(|H1 ∘ H2| · |порождающих H1|)
+     * операций вместо сравнения H1 ∘ H2 с H2 ∘ H1 и проверки критерия.
      */
     static bool is_product_subgroup(const Subgroup& H1, const Subgroup& H2) {
-        set_type H1H2 = product(H1, H2);
-        set_type H2H1 = product(H2, H1);
-        
-        // Произведение является подгруппой тогда и только тогда, когда H1H2 = H2H1
-        if (H1H2 != H2H1) {
-            return false;
+        require_same_parent(H1, H2);
+        const group_type& group = H1.parent_group_;
+        const std::vector<size_t> indices = product_indices(H1, H2);
+        std::vector<bool> in_product(group.indexed_elements().size(), false);
+        for (size_t i : indices) {
+            in_product[i] = true;
         }
 
-        // Проверяем критерий подгруппы
-        Subgroup temp(H1.parent_group_, H1H2);
-        return temp.verify_subgroup_criterion();
+        for (const auto& h : H1.generators()) {
+            const size_t s = group.index_of(h);
+            for (size_t x : indices) {
+                if (!in_product[group.operate_indices(x, s)]) {
+                    return false;
+                }
+            }
+        }
+        return true;
     }
 
     /**
@@ -214,8 +351,57 @@ public:
     }
 
 private:
+    static void require_same_parent(const Subgroup& H1, const Subgroup& H2) {
+        if (&H1.parent_group_ != &H2.parent_group_) {
+            throw std::domain_error("Subgroups must be from the same parent group");
+        }
+    }
+
+    /**
+     * @brief Битовая строка подгруппы над индексами элементов группы
+     */
+    BitMatrix index_row() const {
+        BitMatrix result(1, parent_group_.indexed_elements().size());
+        for (const auto& h : subset_) {
+            result.set(0, parent_group_.index_of(h));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Индексы элементов H1 ∘ H2 объединением классов h1 ∘ H2
+     */
+    static std::vector<size_t> product_indices(const Subgroup& H1, const Subgroup& H2) {
+        const group_type& group = H1.parent_group_;
+        std::vector<size_t> right;
+        right.reserve(H2.size());
+        for (const auto& k : H2.subset_) {
+            right.push_back(group.index_of(k));
+        }
+
+        BitMatrix covered(1, group.indexed_elements().size());
+        std::vector<size_t> result;
+        const size_t expected = product_size(H1, H2);
+        for (const auto& h : H1.subset_) {
+            if (result.size() == expected) {
+                break;
+            }
+            const size_t left = group.index_of(h);
+            if (covered.test(0, left)) {
+                continue;
+            }
+            for (size_t k : right) {
+                const size_t x = group.operate_indices(left, k);
+                covered.set(0, x);
+                result.push_back(x);
+            }
+        }
+        return result;
+    }
+
     const group_type& parent_group_;
     set_type subset_;
+    mutable std::optional<std::vector<T>> generators_; // Лениво выбранные порождающие
 };
 
 /**
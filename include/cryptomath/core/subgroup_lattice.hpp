@@ -0,0 +1,457 @@
+#pragma once
+
+#include "bit_matrix.hpp"
+#include "relation_graph.hpp"
+#include "group.hpp"
+#include "subgroup.hpp"
+#include "set.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Решётка всех подгрупп конечной группы
+ *
+ * Подгруппы перечисляются методом циклических расширений. Каждая подгруппа
+ * порождается своими элементами примарного порядка p^k, поэтому достаточно
+ * циклических подгрупп примарного порядка Z₁, ..., Z_m: начиная с {e}, каждая
+ * найденная подгруппа H расширяется до ⟨H, Zᵢ⟩ для всех Zᵢ ⊄ H (алгоритм
+ * Димино, detail::extend_closure). Подгруппа хранится битовой строкой над
+ * индексами элементов группы; повторы отсекаются по хэшу строки с пословным
+ * сравнением при совпадении хэшей. Затраты: O(s · m · |G|) умножений для
+ * s подгрупп; для групп порядка до multiplication_table_limit умножения
+ * индексов заранее сводятся в таблицу |G|², и каждое стоит одного обращения
+ * к памяти вместо операции над элементами и двоичного поиска индекса.
+ *
+ * Подгруппы пронумерованы по возрастанию порядка (при равных порядках - по
+ * битовым строкам): номер 0 - тривиальная подгруппа, size() - 1 - сама группа.
+ * Номер подгруппы является топологическим порядком решётки по включению.
+ */
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class SubgroupLattice {
+public:
+    using group_type = Group<T, Op>;
+    using element_type = T;
+    using set_type = Set<T>;
+    using subgroup_type = Subgroup<T, Op>;
+    using word_type = BitMatrix::word_type;
+
+    explicit SubgroupLattice(const group_type& group)
+        : group_(group) {
+        const size_t n = group_.indexed_elements().size();
+        words_per_row_ = (n + BitMatrix::word_bits - 1) / BitMatrix::word_bits;
+
+        std::vector<word_type> words;
+        std::vector<std::vector<size_t>> generators;
+        std::vector<size_t> orders;
+        std::unordered_map<std::uint64_t, std::vector<size_t>> buckets;
+
+        // Добавить подгруппу, если её ещё нет; closure - её элементы
+        auto insert = [&](const std::vector<size_t>& closure, std::vector<size_t> generating) {
+            std::vector<word_type> row(words_per_row_, 0);
+            for (size_t i : closure) {
+                row[i / BitMatrix::word_bits] |= word_type{1} << (i % BitMatrix::word_bits);
+            }
+            auto& bucket = buckets[hash_row(row.data())];
+            for (size_t id : bucket) {
+                if (std::equal(row.begin(), row.end(), words.begin() + id * words_per_row_)) {
+                    return;
+                }
+            }
+            bucket.push_back(orders.size());
+            words.insert(words.end(), row.begin(), row.end());
+            generators.push_back(std::move(generating));
+            orders.push_back(closure.size());
+        };
+
+        const IndexProducts products(group_);
+        const size_t identity = group_.index_of(group_.identity());
+        insert({identity}, {});
+
+        const std::vector<size_t> zuppos = prime_power_cyclic_generators(products, identity);
+        std::vector<bool> in_closure(n, false);
+        std::vector<size_t> closure;
+        for (size_t head = 0; head < orders.size(); ++head) {
+            for (size_t z : zuppos) {
+                const word_type* row = words.data() + head * words_per_row_;
+                if ((row[z / BitMatrix::word_bits] >> (z % BitMatrix::word_bits)) & 1) {
+                    continue;
+                }
+
+                // words может перераспределиться в insert, поэтому строка H копируется в closure
+                std::fill(in_closure.begin(), in_closure.end(), false);
+                closure.clear();
+                for_each_bit(row, [&](size_t i) {
+                    in_closure[i] = true;
+                    closure.push_back(i);
+                });
+                std::vector<size_t> generating = generators[head];
+                generating.push_back(z);
+                detail::extend_closure(products, in_closure, closure, generating);
+                insert(closure, std::move(generating));
+            }
+        }
+
+        // Перенумерация по возрастанию порядка
+        const size_t count = orders.size();
+        std::vector<size_t> permutation(count);
+        std::iota(permutation.begin(), permutation.end(), size_t{0});
+        std::sort(permutation.begin(), permutation.end(), [&](size_t a, size_t b) {
+            if (orders[a] != orders[b]) {
+                return orders[a] < orders[b];
+            }
+            return std::lexicographical_compare(
+                words.begin() + a * words_per_row_, words.begin() + (a + 1) * words_per_row_,
+                words.begin() + b * words_per_row_, words.begin() + (b + 1) * words_per_row_);
+        });
+
+        members_ = BitMatrix(count, n);
+        orders_.reserve(count);
+        generators_.reserve(count);
+        for (size_t k = 0; k < count; ++k) {
+            const size_t id = permutation[k];
+            std::copy(words.begin() + id * words_per_row_, words.begin() + (id + 1) * words_per_row_,
+                      members_.row(k));
+            orders_.push_back(orders[id]);
+            generators_.push_back(std::move(generators[id]));
+            index_by_hash_[hash_row(members_.row(k))].push_back(k);
+        }
+    }
+
+    /**
+     * @brief Наибольший порядок группы, для которого строится таблица умножения индексов
+     *
+     * Таблица занимает 4 · |G|² байт (16 МБ при |G| = 2048).
+     */
+    static constexpr size_t multiplication_table_limit = 2048;
+
+    /**
+     * @brief Исходная группа
+     */
+    const group_type& group() const noexcept {
+        return group_;
+    }
+
+    /**
+     * @brief Число подгрупп
+     */
+    size_t size() const noexcept {
+        return orders_.size();
+    }
+
+    /**
+     * @brief Порядок подгруппы с номером i
+     */
+    size_t order(size_t i) const {
+        require_subgroup(i);
+        return orders_[i];
+    }
+
+    /**
+     * @brief Элементы подгруппы i в виде битовой строки (строка i матрицы)
+     *
+     * Бит j строки i равен 1, если element_at(j) лежит в подгруппе i.
+     */
+    const BitMatrix& membership() const noexcept {
+        return members_;
+    }
+
+    /**
+     * @brief Индексы элементов подгруппы i по возрастанию
+     */
+    std::vector<size_t> element_indices(size_t i) const {
+        require_subgroup(i);
+        std::vector<size_t> result;
+        result.reserve(orders_[i]);
+        members_.for_each_in_row(i, [&](size_t j) { result.push_back(j); });
+        return result;
+    }
+
+    /**
+     * @brief Индексы порождающих подгруппы i (циклические расширения, приведшие к ней)
+     */
+    const std::vector<size_t>& generator_indices(size_t i) const {
+        require_subgroup(i);
+        return generators_[i];
+    }
+
+    /**
+     * @brief Подгруппа с номером i (без повторной проверки критерия)
+     */
+    subgroup_type subgroup(size_t i) const {
+        require_subgroup(i);
+        std::vector<T> values;
+        values.reserve(orders_[i]);
+        members_.for_each_in_row(i, [&](size_t j) { values.push_back(group_.element_at(j)); });
+        return subgroup_type(group_, set_type(values.begin(), values.end()), trusted_subgroup);
+    }
+
+    /**
+     * @brief Номер подгруппы в решётке
+     *
+     * @throws std::domain_error если подгруппа взята из другой группы
+     */
+    size_t find(const subgroup_type& subgroup) const {
+        if (&subgroup.parent_group() != &group_) {
+            throw std::domain_error("Subgroup must be from the lattice group");
+        }
+        std::vector<word_type> row(words_per_row_, 0);
+        for (const auto& h : subgroup.get_subset()) {
+            const size_t i = group_.index_of(h);
+            row[i / BitMatrix::word_bits] |= word_type{1} << (i % BitMatrix::word_bits);
+        }
+        auto k = find_row(row);
+        if (!k.has_value()) {
+            throw std::domain_error("Subgroup not found in lattice");
+        }
+        return *k;
+    }
+
+    /**
+     * @brief Номера подгрупп порядка d
+     */
+    std::vector<size_t> subgroups_of_order(size_t d) const {
+        auto first = std::lower_bound(orders_.begin(), orders_.end(), d);
+        auto last = std::upper_bound(first, orders_.end(), d);
+        std::vector<size_t> result(static_cast<size_t>(last - first));
+        std::iota(result.begin(), result.end(), static_cast<size_t>(first - orders_.begin()));
+        return result;
+    }
+
+    /**
+     * @brief Проверить включение H_i ⊆ H_j за O(|G| / 64)
+     */
+    bool is_contained(size_t i, size_t j) const {
+        require_subgroup(i);
+        require_subgroup(j);
+        return orders_[j] % orders_[i] == 0 && members_.row_subset_of(i, j);
+    }
+
+    /**
+     * @brief Матрица включения: бит (i, j) равен 1, если H_i ⊆ H_j
+     *
+     * Сравниваются только пары, для которых |H_i| делит |H_j| (теорема Лагранжа).
+     */
+    const BitMatrix& containment() const {
+        if (!containment_.has_value()) {
+            const size_t count = size();
+            BitMatrix result(count, count);
+            for (size_t i = 0; i < count; ++i) {
+                result.set(i, i);
+                for (size_t j = i + 1; j < count; ++j) {
+                    if (orders_[j] > orders_[i] && orders_[j] % orders_[i] == 0 &&
+                        members_.row_subset_of(i, j)) {
+                        result.set(i, j);
+                    }
+                }
+            }
+            containment_ = std::move(result);
+        }
+        return *containment_;
+    }
+
+    /**
+     * @brief Диаграмма Хассе решётки: дуга (i, j), если H_i - максимальная подгруппа H_j
+     *
+     * Как в PartialOrder::hasse_diagram: строгие надгруппы H_i перебираются по
+     * возрастанию номера (топологический порядок), и непомеченная надгруппа
+     * покрывает H_i, после чего помечаются все её надгруппы.
+     */
+    const RelationGraph& hasse_diagram() const {
+        if (!hasse_.has_value()) {
+            const size_t count = size();
+            const BitMatrix& order = containment();
+            std::vector<std::pair<size_t, size_t>> covers;
+            BitMatrix marked(1, count);
+            for (size_t i = 0; i < count; ++i) {
+                marked.clear_row(0);
+                order.for_each_in_row(i, [&](size_t j) {
+                    if (j != i && !marked.test(0, j)) {
+                        covers.emplace_back(i, j);
+                        marked.or_row(0, order, j);
+                    }
+                });
+            }
+            hasse_ = RelationGraph(count, std::move(covers));
+        }
+        return *hasse_;
+    }
+
+    /**
+     * @brief Номера максимальных подгрупп H_j
+     */
+    std::vector<size_t> maximal_subgroups(size_t j) const {
+        require_subgroup(j);
+        const RelationGraph& hasse = hasse_diagram();
+        std::vector<size_t> result;
+        for (size_t i = 0; i < j; ++i) {
+            if (hasse.has_edge(i, j)) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Номер пересечения H_i ∩ H_j (пословное И битовых строк)
+     */
+    size_t meet(size_t i, size_t j) const {
+        require_subgroup(i);
+        require_subgroup(j);
+        std::vector<word_type> row(members_.row(i), members_.row(i) + words_per_row_);
+        const word_type* other = members_.row(j);
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            row[w] &= other[w];
+        }
+        return *find_row(row); // Пересечение подгрупп - подгруппа решётки
+    }
+
+    /**
+     * @brief Номер наименьшей подгруппы, содержащей H_i и H_j
+     *
+     * Это наименьшая по номеру общая надгруппа: все надгруппы H_i ∪ H_j
+     * содержат ⟨H_i, H_j⟩, а она сама является одной из них.
+     */
+    size_t join(size_t i, size_t j) const {
+        require_subgroup(i);
+        require_subgroup(j);
+        const BitMatrix& order = containment();
+        for (size_t k = std::max(i, j); k < size(); ++k) {
+            if (order.test(i, k) && order.test(j, k)) {
+                return k;
+            }
+        }
+        return size() - 1;
+    }
+
+private:
+    /**
+     * @brief Умножение индексов элементов для detail::extend_closure
+     *
+     * Для небольших групп - по таблице, иначе через Group::operate_indices.
+     */
+    struct IndexProducts {
+        explicit IndexProducts(const group_type& group)
+            : group(group), n(group.indexed_elements().size()) {
+            if (n <= multiplication_table_limit) {
+                table.resize(n * n);
+                for (size_t i = 0; i < n; ++i) {
+                    for (size_t j = 0; j < n; ++j) {
+                        table[i * n + j] = static_cast<std::uint32_t>(group.operate_indices(i, j));
+                    }
+                }
+            }
+        }
+
+        size_t operate_indices(size_t i, size_t j) const {
+            return table.empty() ? group.operate_indices(i, j) : table[i * n + j];
+        }
+
+        const group_type& group;
+        size_t n;
+        std::vector<std::uint32_t> table;
+    };
+
+    /**
+     * @brief По одному порождающему каждой циклической подгруппы примарного порядка
+     *
+     * Степени g перебираются один раз на циклическую подгруппу: после обхода
+     * ⟨g⟩ порядка m все её порождающие g^k, НОД(k, m) = 1, помечаются.
+     */
+    static std::vector<size_t> prime_power_cyclic_generators(const IndexProducts& products, size_t identity) {
+        const size_t n = products.n;
+        std::vector<bool> seen(n, false);
+        seen[identity] = true;
+        std::vector<size_t> result;
+        std::vector<size_t> powers;
+        for (size_t g = 0; g < n; ++g) {
+            if (seen[g]) {
+                continue;
+            }
+            powers.assign({g});
+            while (powers.back() != identity) {
+                powers.push_back(products.operate_indices(powers.back(), g));
+            }
+            const size_t m = powers.size();
+            for (size_t k = 1; k <= m; ++k) {
+                if (std::gcd(k, m) == 1) {
+                    seen[powers[k - 1]] = true;
+                }
+            }
+            if (is_prime_power(m)) {
+                result.push_back(g);
+            }
+        }
+        return result;
+    }
+
+    static bool is_prime_power(size_t m) {
+        for (size_t p = 2; p * p <= m; ++p) {
+            if (m % p == 0) {
+                while (m % p == 0) {
+                    m /= p;
+                }
+                return m == 1;
+            }
+        }
+        return m > 1;
+    }
+
+    std::uint64_t hash_row(const word_type* row) const noexcept {
+        std::uint64_t h = 0xcbf29ce484222325ULL;
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            h ^= row[w] + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+
+    template<typename F>
+    void for_each_bit(const word_type* row, F f) const {
+        for (size_t w = 0; w < words_per_row_; ++w) {
+            word_type bits = row[w];
+            while (bits != 0) {
+                f(w * BitMatrix::word_bits + static_cast<size_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    std::optional<size_t> find_row(const std::vector<word_type>& row) const {
+        auto it = index_by_hash_.find(hash_row(row.data()));
+        if (it != index_by_hash_.end()) {
+            for (size_t k : it->second) {
+                if (std::equal(row.begin(), row.end(), members_.row(k))) {
+                    return k;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    void require_subgroup(size_t i) const {
+        if (i >= orders_.size()) {
+            throw std::out_of_range("Subgroup number out of range");
+        }
+    }
+
+    const group_type& group_;
+    size_t words_per_row_ = 0;
+    BitMatrix members_;                            // Строка i - элементы подгруппы i
+    std::vector<size_t> orders_;                   // Неубывающие порядки подгрупп
+    std::vector<std::vector<size_t>> generators_;  // Индексы порождающих подгрупп
+    std::unordered_map<std::uint64_t, std::vector<size_t>> index_by_hash_;
+    mutable std::optional<BitMatrix> containment_;
+    mutable std::optional<RelationGraph> hasse_;
+};
+
+} // namespace cryptomath
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "group.hpp"
+#include "subgroup.hpp"
+#include "set.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace cryptomath {
+
+/**
+ * @brief Силовская p-подгруппа конечной группы
+ *
+ * Для |G| = p^a · m, НОД(p, m) = 1, силовская p-подгруппа имеет порядок p^a.
+ * Строится ростом p-подгрупп через нормализаторы: пока |P| < p^a, индекс
+ * [N_G(P) : P] делится на p (иначе P была бы силовской), и по теореме Коши в
+ * N_G(P) / P есть элемент порядка p. Его прообраз x ∈ N_G(P) ищется среди
+ * p-частей y^m элементов N_G(P), m = |G| / p^a, и P заменяется на
+ * ⟨P, x⟩ порядка p · |P| (алгоритм Димино, detail::extend_closure).
+ *
+ * Все вычисления ведутся над индексами элементов группы без перебора
+ * подмножеств. На каждом из a шагов нормализатор проверяется на порождающих P
+ * за O(|G| · a) умножений индексов, а поиск x возводит в степень не более |G|
+ * кандидатов за O(log |G|) умножений каждый. Всего O(|G| · a · (a + log |G|))
+ * вызовов operate_indices; каждый - одна операция группы и двоичный поиск
+ * индекса результата за O(log |G|) сравнений.
+ * Число силовских подгрупп n_p = [G : N_G(P)] определяется по нормализатору,
+ * сами сопряжённые подгруппы перечисляются лениво (conjugates()).
+ */
+template<typename T, typename Op>
+    requires GroupConcept<T, Op>
+class SylowSubgroup {
+public:
+    using group_type = Group<T, Op>;
+    using element_type = T;
+    using set_type = Set<T>;
+    using subgroup_type = Subgroup<T, Op>;
+
+    /**
+     * @brief Найти силовскую p-подгруппу группы
+     *
+     * @throws std::invalid_argument если p не является простым числом
+     */
+    SylowSubgroup(const group_type& group, size_t p)
+        : group_(group), prime_(p) {
+        if (!is_prime(p)) {
+            throw std::invalid_argument("Sylow subgroup requires a prime p");
+        }
+
+        const size_t n = group_.indexed_elements().size();
+        sylow_order_ = 1;
+        for (size_t m = n; m % p == 0; m /= p) {
+            sylow_order_ *= p;
+        }
+
+        identity_ = group_.index_of(group_.identity());
+        std::vector<bool> in_subgroup(n, false);
+        elements_.push_back(identity_);
+        in_subgroup[identity_] = true;
+
+        while (elements_.size() < sylow_order_) {
+            const std::vector<size_t> normalizer = compute_normalizer(in_subgroup);
+            generators_.push_back(find_extension(normalizer, in_subgroup));
+            detail::extend_closure(group_, in_subgroup, elements_, generators_);
+        }
+        std::sort(elements_.begin(), elements_.end());
+        normalizer_ = compute_normalizer(in_subgroup);
+    }
+
+    /**
+     * @brief Простое число p
+     */
+    size_t prime() const noexcept {
+        return prime_;
+    }
+
+    /**
+     * @brief Порядок силовской подгруппы p^a
+     */
+    size_t order() const noexcept {
+        return sylow_order_;
+    }
+
+    /**
+     * @brief Индексы элементов подгруппы по возрастанию
+     */
+    const std::vector<size_t>& element_indices() const noexcept {
+        return elements_;
+    }
+
+    /**
+     * @brief Индексы порождающих: по одному на каждый шаг роста, всего a
+     */
+    const std::vector<size_t>& generator_indices() const noexcept {
+        return generators_;
+    }
+
+    /**
+     * @brief Индексы элементов нормализатора N_G(P) по возрастанию
+     */
+    const std::vector<size_t>& normalizer_indices() const noexcept {
+        return normalizer_;
+    }
+
+    /**
+     * @brief Силовская подгруппа (без повторной проверки критерия)
+     */
+    subgroup_type subgroup() const {
+        return to_subgroup(elements_);
+    }
+
+    /**
+     * @brief Нормализатор N_G(P) (без повторной проверки критерия)
+     */
+    subgroup_type normalizer() const {
+        return to_subgroup(normalizer_);
+    }
+
+    /**
+     * @brief Число силовских p-подгрупп n_p = [G : N_G(P)]
+     *
+     * Все силовские p-подгруппы сопряжены (вторая теорема Силова), поэтому n_p -
+     * длина орбиты P при сопряжении, равная индексу стабилизатора N_G(P).
+     */
+    size_t count() const noexcept {
+        return group_.indexed_elements().size() / normalizer_.size();
+    }
+
+    /**
+     * @brief Проверить, является ли P нормальной (n_p = 1)
+     */
+    bool is_normal() const noexcept {
+        return count() == 1;
+    }
+
+    /**
+     * @brief Все силовские p-подгруппы
+     *
+     * Орбита P при сопряжении порождающими G, обход в ширину: каждая
+     * сопряжённая подгруппа хранится отсортированным списком индексов.
+     * Затраты: O(n_p · |P| · |порождающих G|) операций.
+     */
+    std::vector<subgroup_type> conjugates() const {
+        const std::vector<size_t>& generators = group_.generator_indices();
+        std::vector<std::vector<size_t>> orbit{elements_};
+        std::set<std::vector<size_t>> seen{elements_};
+
+        for (size_t head = 0; head < orbit.size(); ++head) {
+            for (size_t s : generators) {
+                const size_t s_inverse = group_.inverse_index(s);
+                std::vector<size_t> conjugate;
+                conjugate.reserve(orbit[head].size());
+                for (size_t h : orbit[head]) {
+                    conjugate.push_back(group_.operate_indices(group_.operate_indices(s, h), s_inverse));
+                }
+                std::sort(conjugate.begin(), conjugate.end());
+                if (seen.insert(conjugate).second) {
+                    orbit.push_back(std::move(conjugate));
+                }
+            }
+        }
+
+        std::vector<subgroup_type> result;
+        result.reserve(orbit.size());
+        for (const auto& indices : orbit) {
+            result.push_back(to_subgroup(indices));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Проверить третью теорему Силова: n_p ≡ 1 (mod p) и n_p | m
+     */
+    bool verify_sylow_theorems() const {
+        const size_t n_p = count();
+        const size_t m = group_.indexed_elements().size() / sylow_order_;
+        return n_p % prime_ == 1 % prime_ && m % n_p == 0;
+    }
+
+    /**
+     * @brief Проверить, является ли n простым числом
+     */
+    static bool is_prime(size_t n) noexcept {
+        if (n < 2) {
+            return false;
+        }
+        for (size_t d = 2; d * d <= n; ++d) {
+            if (n % d == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    /**
+     * @brief Нормализатор P: g ∘ s ∘ g⁻¹ ∈ P для всех порождающих s подгруппы P
+     */
+    std::vector<size_t> compute_normalizer(const std::vector<bool>& in_subgroup) const {
+        const size_t n = group_.indexed_elements().size();
+        std::vector<size_t> result;
+        for (size_t g = 0; g < n; ++g) {
+            const size_t g_inverse = group_.inverse_index(g);
+            bool normalizes = true;
+            for (size_t s : generators_) {
+                if (!in_subgroup[group_.operate_indices(group_.operate_indices(g, s), g_inverse)]) {
+                    normalizes = false;
+                    break;
+                }
+            }
+            if (normalizes) {
+                result.push_back(g);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Элемент x ∈ N_G(P) \ P с x^p ∈ P
+     *
+     * Для y ∈ N_G(P) порядка p^k · r, НОД(p, r) = 1, элемент z = y^m,
+     * m = |G| / p^a, - p-элемент: r делит m, и m / r взаимно просто с p, поэтому
+     * ⟨y^m⟩ = ⟨y^r⟩. Порядок y вычислять не нужно. Если z ∉ P, то z заменяется
+     * на z^p, пока z^p ∉ P; образ z в N_G(P) / P имеет порядок p.
+     */
+    size_t find_extension(const std::vector<size_t>& normalizer,
+                          const std::vector<bool>& in_subgroup) const {
+        const size_t m = group_.indexed_elements().size() / sylow_order_;
+        for (size_t y : normalizer) {
+            if (in_subgroup[y]) {
+                continue;
+            }
+
+            size_t z = power_index(y, m);
+            if (in_subgroup[z]) {
+                continue;
+            }
+            for (size_t next = power_index(z, prime_); !in_subgroup[next]; next = power_index(z, prime_)) {
+                z = next;
+            }
+            return z;
+        }
+        throw std::logic_error("Normalizer quotient has no element of order p");
+    }
+
+    size_t power_index(size_t base, size_t exponent) const {
+        size_t result = identity_;
+        while (exponent > 0) {
+            if (exponent & 1) {
+                result = group_.operate_indices(result, base);
+            }
+            base = group_.operate_indices(base, base);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    subgroup_type to_subgroup(const std::vector<size_t>& indices) const {
+        std::vector<T> values;
+        values.reserve(indices.size());
+        for (size_t i : indices) {
+            values.push_back(group_.element_at(i));
+        }
+        return subgroup_type(group_, set_type(values.begin(), values.end()), trusted_subgroup);
+    }
+
+    const group_type& group_;
+    size_t prime_;
+    size_t sylow_order_ = 1;
+    size_t identity_ = 0;
+    std::vector<size_t> elements_;                 // Элементы P по возрастанию индексов
+    std::vector<size_t> generators_;               // Порождающие P по шагам роста
+    std::vector<size_t> normalizer_;               // N_G(P) по возрастанию индексов
+};
+
+} // namespace cryptomath
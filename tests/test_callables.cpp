@@ -0,0 +1,45 @@
+#include "test_common.hpp"
+
+using namespace cryptomath;
+using test::AddMod;
+
+int main() {
+    const auto group = test::cyclic_group(12);
+    const NormalSubgroup<int, AddMod> normal(Subgroup<int, AddMod>(group, Set<int>{0, 3, 6, 9}));
+
+    // Операция фактор-группы не зависит от времени жизни FactorGroup
+    auto operation = FactorGroup<int, AddMod>(group, normal).get_operation();
+    const FactorGroup<int, AddMod> factor(group, normal);
+    for (const auto& a : factor.get_cosets()) {
+        for (const auto& b : factor.get_cosets()) {
+            // Прямое вычисление (a + b) + N
+            std::vector<int> expected;
+            for (int n : normal.get_subset()) {
+                expected.push_back((*a.begin() + *b.begin() + n) % 12);
+            }
+            CHECK(operation(a, b) == Set<int>(expected.begin(), expected.end()));
+            CHECK(factor.operate(a, b) == operation(a, b));
+        }
+    }
+
+    // Копия операции пригодна после присваивания
+    auto copy = factor.get_operation();
+    copy = operation;
+    CHECK(copy(factor.identity(), factor.identity()) == factor.identity());
+
+    // Отображение с пользовательской функцией вычисляется так же, как сама функция
+    const auto domain = test::range_set(12);
+    auto doubling = [](int x) { return (2 * x) % 12; };
+    Mapping<int, int> mapping(domain, domain, doubling);
+    for (int x = 0; x < 12; ++x) {
+        CHECK(mapping(x) == doubling(x));
+    }
+
+    // Группа с функциональным объектом операции совпадает с прямым вычислением
+    for (int a = 0; a < 12; ++a) {
+        CHECK(group.inverse(a) == (12 - a) % 12);
+        CHECK(group.get_operation()(a, 5) == (a + 5) % 12);
+    }
+
+    return test::finish();
+}
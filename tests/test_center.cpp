@@ -0,0 +1,82 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Центр по определению: z, перестановочные со всеми элементами группы
+ */
+template<typename T, typename Op>
+Set<T> naive_center(const Group<T, Op>& group) {
+    Set<T> result;
+    for (const auto& z : group.get_set()) {
+        bool central = true;
+        for (const auto& g : group.get_set()) {
+            central = central && group.operate_unchecked(z, g) == group.operate_unchecked(g, z);
+        }
+        if (central) {
+            result.insert(z);
+        }
+    }
+    return result;
+}
+
+template<typename T, typename Op>
+void check_center(const Group<T, Op>& group, size_t expected_size) {
+    const Set<T> expected = naive_center(group);
+    CHECK(expected.size() == expected_size);
+    CHECK(group.center() == expected);
+    CHECK((Center<T, Op>::compute(group) == expected));
+    CHECK((Center<T, Op>::size(group) == expected.size()));
+    CHECK((Center<T, Op>::is_abelian(group) == (expected == group.get_set())));
+    CHECK((Center<T, Op>::is_centerless(group) == (expected.size() == 1)));
+    for (const auto& a : group.get_set()) {
+        CHECK((Center<T, Op>::is_in_center(group, a) == expected.contains(a)));
+
+        Set<T> centralizer;
+        for (const auto& g : group.get_set()) {
+            if (group.operate_unchecked(g, a) == group.operate_unchecked(a, g)) {
+                centralizer.insert(g);
+            }
+        }
+        CHECK((Centralizer<T, Op>::compute(group, a) == centralizer));
+    }
+
+    // Кэшированные порождающие порождают всю группу, и их не больше log₂ |G|
+    const std::vector<size_t>& generators = group.generator_indices();
+    std::vector<bool> reached(group.indexed_elements().size(), false);
+    std::vector<size_t> queue{group.index_of(group.identity())};
+    reached[queue.front()] = true;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (size_t s : generators) {
+            const size_t next = group.operate_indices(queue[head], s);
+            if (!reached[next]) {
+                reached[next] = true;
+                queue.push_back(next);
+            }
+        }
+    }
+    CHECK(queue.size() == group.indexed_elements().size());
+    CHECK((size_t{1} << generators.size()) <= group.indexed_elements().size());
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_center(test::cyclic_group(12), 12);
+    check_center(test::units_group(21), 12);
+    check_center(symmetric_group<3>(), 1);
+    check_center(symmetric_group<4>(), 1);
+    check_center(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})}), 2);      // D4
+    check_center(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}), 1);          // A4
+    check_center(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})}), 2); // D6
+    check_center(test::permutation_group<6>({P6::cycle({0, 1, 2}), P6::cycle({3, 4})}), 6);         // Z3 × Z2
+
+    const auto group = test::cyclic_group(5);
+    CHECK_THROWS((Centralizer<int, test::AddMod>::compute(group, 7)), std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,29 @@
+#include "test_common.hpp"
+
+using namespace cryptomath;
+using test::AddMod;
+
+int main() {
+    const auto group = test::cyclic_group(12);
+
+    // operate_unchecked совпадает с проверяемой операцией на всех парах
+    for (int a = 0; a < 12; ++a) {
+        for (int b = 0; b < 12; ++b) {
+            CHECK(group.operate_unchecked(a, b) == group.operate(a, b));
+            CHECK(group.operate(a, b) == (a + b) % 12);
+        }
+    }
+
+#if CRYPTOMATH_CHECKED_OPERATIONS
+    // Определение из INTERFACE-цели CMake включает проверки на границе API
+    CHECK_THROWS(group.operate(99, 2), std::domain_error);
+    CHECK_THROWS(group.operate(2, -1), std::domain_error);
+#endif
+
+    // Алгоритмы проверяют вход один раз независимо от настройки
+    CHECK_THROWS(group.power(99, 2), std::domain_error);
+    CHECK(group.divide(1, 2) == 11);
+    CHECK(group.left_divide(1, 2) == 11);
+
+    return test::finish();
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cryptomath/core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Общие средства тестов: проверки с подсчётом ошибок и малые группы
+ */
+namespace cryptomath::test {
+
+inline int& failure_count() {
+    static int count = 0;
+    return count;
+}
+
+inline void check(bool condition, const char* expression, const char* file, int line) {
+    if (!condition) {
+        ++failure_count();
+        std::cerr << file << ":" << line << ": check failed: " << expression << "\n";
+    }
+}
+
+/**
+ * @brief Код возврата теста: 0, если все проверки прошли
+ */
+inline int finish() {
+    if (failure_count() != 0) {
+        std::cerr << failure_count() << " check(s) failed\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Сложение по модулю n
+ */
+struct AddMod {
+    int n;
+
+    int operator()(int a, int b) const {
+        return (a + b) % n;
+    }
+};
+
+/**
+ * @brief Умножение по модулю n
+ */
+struct MulMod {
+    int n;
+
+    int operator()(int a, int b) const {
+        return static_cast<int>(static_cast<long long>(a) * b % n);
+    }
+};
+
+/**
+ * @brief Множество {0, 1, ..., n - 1}
+ */
+inline Set<int> range_set(int n) {
+    Set<int> result;
+    for (int i = 0; i < n; ++i) {
+        result.insert(i);
+    }
+    return result;
+}
+
+/**
+ * @brief Циклическая группа Z_n по сложению
+ */
+inline Group<int, AddMod> cyclic_group(int n) {
+    return Group<int, AddMod>(range_set(n), AddMod{n}, 0, [n](int a) { return (n - a) % n; });
+}
+
+/**
+ * @brief Мультипликативная группа вычетов Z_n^* (элементы, взаимно простые с n)
+ */
+inline Group<int, MulMod> units_group(int n) {
+    Set<int> units;
+    for (int i = 1; i < n; ++i) {
+        if (std::gcd(i, n) == 1) {
+            units.insert(i);
+        }
+    }
+    return Group<int, MulMod>(Monoid<int, MulMod>(units, MulMod{n}, 1));
+}
+
+/**
+ * @brief Группа перестановок степени N, порождённая generators (замыкание обходом в ширину)
+ */
+template<size_t N>
+Group<Permutation<N>, PermutationComposition> permutation_group(const std::vector<Permutation<N>>& generators) {
+    std::vector<Permutation<N>> elements{Permutation<N>::identity()};
+    Set<Permutation<N>> seen(elements.begin(), elements.end());
+    for (size_t head = 0; head < elements.size(); ++head) {
+        for (const auto& g : generators) {
+            const Permutation<N> next = elements[head] * g;
+            if (!seen.contains(next)) {
+                seen.insert(next);
+                elements.push_back(next);
+            }
+        }
+    }
+    return Group<Permutation<N>, PermutationComposition>(
+        seen, PermutationComposition{}, Permutation<N>::identity(),
+        [](const Permutation<N>& p) { return Permutation<N>::inverse(p); });
+}
+
+/**
+ * @brief Подгруппа, порождённая seeds: обход в ширину умножениями справа на seeds
+ */
+template<typename T, typename Op>
+Set<T> generated_set(const Group<T, Op>& group, const Set<T>& seeds) {
+    std::vector<T> elements{group.identity()};
+    Set<T> result(elements.begin(), elements.end());
+    for (size_t head = 0; head < elements.size(); ++head) {
+        for (const auto& s : seeds) {
+            const T next = group.operate_unchecked(elements[head], s);
+            if (!result.contains(next)) {
+                result.insert(next);
+                elements.push_back(next);
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Все подгруппы группы: циклические подгруппы и их попарные соединения до насыщения
+ */
+template<typename T, typename Op>
+Set<Set<T>> naive_subgroups(const Group<T, Op>& group) {
+    std::vector<Set<T>> subgroups;
+    Set<Set<T>> seen;
+    const auto add = [&](const Set<T>& subgroup) {
+        if (!seen.contains(subgroup)) {
+            seen.insert(subgroup);
+            subgroups.push_back(subgroup);
+        }
+    };
+    for (const auto& g : group.get_set()) {
+        add(generated_set(group, Set<T>{g}));
+    }
+    for (size_t i = 0; i < subgroups.size(); ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            add(generated_set(group, subgroups[i] + subgroups[j]));
+        }
+    }
+    return seen;
+}
+
+/**
+ * @brief Линейный конгруэнтный генератор: воспроизводимые данные без <random>
+ */
+struct Lcg {
+    std::uint64_t state;
+
+    std::uint64_t next() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return state >> 16;
+    }
+};
+
+/**
+ * @brief Случайное отношение на {0, ..., n - 1} из не более чем pair_count пар
+ */
+inline Relation<int> random_relation(int n, size_t pair_count, Lcg& random) {
+    Set<std::pair<int, int>> pairs;
+    for (size_t k = 0; k < pair_count; ++k) {
+        const int a = static_cast<int>(random.next() % static_cast<std::uint64_t>(n));
+        const int b = static_cast<int>(random.next() % static_cast<std::uint64_t>(n));
+        pairs.insert({a, b});
+    }
+    return Relation<int>(range_set(n), pairs);
+}
+
+/**
+ * @brief Рефлексивно-транзитивное замыкание обходом в глубину из каждого элемента
+ */
+template<typename T>
+Set<std::pair<T, T>> naive_closure(const Relation<T>& relation) {
+    Set<std::pair<T, T>> result;
+    for (const auto& a : relation.get_set()) {
+        Set<T> visited{a};
+        std::vector<T> stack{a};
+        while (!stack.empty()) {
+            const T x = stack.back();
+            stack.pop_back();
+            for (const auto& y : relation.get_set()) {
+                if (relation.related(x, y) && !visited.contains(y)) {
+                    visited.insert(y);
+                    stack.push_back(y);
+                }
+            }
+        }
+        for (const auto& b : visited) {
+            result.insert({a, b});
+        }
+    }
+    return result;
+}
+
+} // namespace cryptomath::test
+
+#define CHECK(condition) ::cryptomath::test::check((condition), #condition, __FILE__, __LINE__)
+
+#define CHECK_THROWS(expression, exception_type)                                   \
+    do {                                                                           \
+        bool thrown_ = false;                                                      \
+        try {                                                                      \
+            (void)(expression);                                                    \
+        } catch (const exception_type&) {                                          \
+            thrown_ = true;                                                        \
+        }                                                                          \
+        ::cryptomath::test::check(thrown_, #expression " throws " #exception_type, \
+                                  __FILE__, __LINE__);                             \
+    } while (0)
@@ -0,0 +1,166 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Все сопряжённые g ∘ s ∘ g⁻¹, g ∈ G, s ∈ S
+ */
+template<typename T, typename Op>
+Set<T> naive_conjugates(const Group<T, Op>& group, const Set<T>& subset) {
+    Set<T> result;
+    for (const auto& g : group.get_set()) {
+        const T g_inverse = group.inverse(g);
+        for (const auto& s : subset) {
+            result.insert(group.operate_unchecked(group.operate_unchecked(g, s), g_inverse));
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Нормальное ядро по определению: ∩ g H g⁻¹ по всем g ∈ G
+ */
+template<typename T, typename Op>
+Set<T> naive_core(const Group<T, Op>& group, const Set<T>& subset) {
+    Set<T> result;
+    for (const auto& h : subset) {
+        if (naive_conjugates(group, Set<T>{h}).is_subset_of(subset)) {
+            result.insert(h);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Подгруппа, порождённая всеми коммутаторами [a, b], a ∈ A, b ∈ B
+ */
+template<typename T, typename Op>
+Set<T> naive_commutator(const Group<T, Op>& group, const Set<T>& a, const Set<T>& b) {
+    Set<T> commutators;
+    for (const auto& x : a) {
+        for (const auto& y : b) {
+            commutators.insert(group.operate_unchecked(
+                group.operate_unchecked(group.inverse(x), group.inverse(y)), group.operate_unchecked(x, y)));
+        }
+    }
+    return test::generated_set(group, commutators);
+}
+
+template<typename T, typename Op>
+void check_series(const Group<T, Op>& group, bool solvable, bool nilpotent) {
+    using Commutator = CommutatorSubgroup<T, Op>;
+    const Set<T>& elements = group.get_set();
+
+    for (const auto& a : elements) {
+        for (const auto& b : elements) {
+            const T expected = group.operate_unchecked(
+                group.operate_unchecked(group.inverse(a), group.inverse(b)), group.operate_unchecked(a, b));
+            CHECK(Commutator::commutator(group, a, b) == expected);
+        }
+    }
+    CHECK(Commutator::derived_subgroup(group).get_subset() == naive_commutator(group, elements, elements));
+
+    // Члены рядов до стабилизации, вычисленные по определению
+    std::vector<Set<T>> derived{elements};
+    for (Set<T> next = naive_commutator(group, elements, elements); next.size() < derived.back().size();
+         next = naive_commutator(group, next, next)) {
+        derived.push_back(next);
+    }
+    std::vector<Set<T>> lower{elements};
+    for (Set<T> next = naive_commutator(group, elements, elements); next.size() < lower.back().size();
+         next = naive_commutator(group, next, elements)) {
+        lower.push_back(next);
+    }
+
+    const auto derived_series = Commutator::derived_series(group);
+    CHECK(derived_series.size() == derived.size());
+    for (size_t i = 0; i < derived.size() && i < derived_series.size(); ++i) {
+        CHECK(derived_series[i].get_subset() == derived[i]);
+    }
+    const auto lower_series = Commutator::lower_central_series(group);
+    CHECK(lower_series.size() == lower.size());
+    for (size_t i = 0; i < lower.size() && i < lower_series.size(); ++i) {
+        CHECK(lower_series[i].get_subset() == lower[i]);
+    }
+
+    CHECK(Commutator::is_solvable(group) == solvable);
+    CHECK(Commutator::is_solvable(group) == (derived.back().size() == 1));
+    CHECK(Commutator::is_nilpotent(group) == nilpotent);
+    CHECK(Commutator::is_nilpotent(group) == (lower.back().size() == 1));
+}
+
+template<typename T, typename Op>
+void check_closures(const Group<T, Op>& group) {
+    const Set<Set<T>> subgroups = test::naive_subgroups(group);
+
+    std::vector<NormalSubgroup<T, Op>> normal;
+    for (const auto& subset : subgroups) {
+        const Subgroup<T, Op> subgroup(group, subset);
+        const Set<T> closure = test::generated_set(group, naive_conjugates(group, subset));
+        CHECK((NormalClosure<T, Op>::compute(subgroup).get_subset() == closure));
+        CHECK((NormalClosure<T, Op>::core(subgroup).get_subset() == naive_core(group, subset)));
+        if (closure == subset) {
+            normal.emplace_back(subgroup, trusted_subgroup);
+        }
+    }
+
+    // Нормальное замыкание произвольного набора элементов
+    const std::vector<T> elements(group.get_set().begin(), group.get_set().end());
+    for (size_t i = 0; i < elements.size(); ++i) {
+        for (size_t j = i; j < elements.size(); j += 3) {
+            const Set<T> seeds{elements[i], elements[j]};
+            const Set<T> closure = test::generated_set(group, naive_conjugates(group, seeds));
+            CHECK((NormalClosure<T, Op>::compute(group, {elements[i], elements[j]}).get_subset() == closure));
+        }
+    }
+    CHECK((NormalClosure<T, Op>::compute(group, {}).size() == 1));
+
+    // Взаимные коммутанты всех пар нормальных подгрупп
+    for (const auto& a : normal) {
+        for (const auto& b : normal) {
+            CHECK((CommutatorSubgroup<T, Op>::compute(a, b).get_subset() ==
+                   naive_commutator(group, a.get_subset(), b.get_subset())));
+        }
+    }
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    const auto z12 = test::cyclic_group(12);
+    const auto s3 = symmetric_group<3>();
+    const auto s4 = symmetric_group<4>();
+    const auto d4 = test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})});
+    const auto a4 = test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})});
+    const auto d6 = test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})});
+
+    check_series(z12, true, true);
+    check_series(s3, true, false);
+    check_series(s4, true, false);
+    check_series(d4, true, true);
+    check_series(a4, true, false);
+    check_series(d6, true, false);
+    check_series(symmetric_group<5>(), false, false);
+
+    check_closures(z12);
+    check_closures(s3);
+    check_closures(s4);
+    check_closures(d4);
+    check_closures(a4);
+    check_closures(d6);
+
+    // Подгруппы разных групп
+    const auto other = symmetric_group<3>();
+    using Normal3 = NormalSubgroup<Permutation<3>, PermutationComposition>;
+    const Normal3 whole(s3, s3.get_set(), trusted_subgroup);
+    const Normal3 foreign(other, other.get_set(), trusted_subgroup);
+    CHECK_THROWS((CommutatorSubgroup<Permutation<3>, PermutationComposition>::compute(whole, foreign)),
+                 std::domain_error);
+
+    return test::finish();
+}
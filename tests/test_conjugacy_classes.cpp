@@ -0,0 +1,74 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Класс сопряжённости по определению: {g ∘ a ∘ g⁻¹ | g ∈ G}
+ */
+template<typename T, typename Op>
+Set<T> naive_class(const Group<T, Op>& group, const T& a) {
+    Set<T> result;
+    for (const auto& g : group.get_set()) {
+        result.insert(group.operate_unchecked(group.operate_unchecked(g, a), group.inverse(g)));
+    }
+    return result;
+}
+
+template<typename T, typename Op>
+void check_classes(const Group<T, Op>& group, size_t expected_count) {
+    const ConjugacyClasses<T, Op> classes(group);
+    CHECK(classes.class_count() == expected_count);
+
+    Set<Set<T>> expected;
+    for (const auto& a : group.get_set()) {
+        const Set<T> expected_class = naive_class(group, a);
+        expected.insert(expected_class);
+        const size_t c = classes.class_of(a);
+        CHECK(classes.class_set(c) == expected_class);
+        CHECK(classes.class_size(c) == expected_class.size());
+        CHECK(classes.representative(c) == *expected_class.begin());
+
+        size_t centralizer = 0;
+        for (const auto& g : group.get_set()) {
+            centralizer += group.operate_unchecked(g, a) == group.operate_unchecked(a, g) ? 1 : 0;
+        }
+        CHECK(classes.centralizer_order(c) == centralizer);
+
+        for (const auto& b : group.get_set()) {
+            CHECK(classes.are_conjugate(a, b) == expected_class.contains(b));
+        }
+    }
+    CHECK(expected.size() == classes.class_count());
+
+    // Члены каждого класса перечислены по возрастанию индексов
+    for (size_t c = 0; c < classes.class_count(); ++c) {
+        const auto members = classes.members(c);
+        for (size_t k = 1; k < members.size(); ++k) {
+            CHECK(members[k - 1] < members[k]);
+        }
+    }
+    CHECK(classes.center() == group.center());
+    CHECK(classes.verify_class_equation());
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_classes(test::cyclic_group(12), 12);
+    check_classes(test::units_group(15), 8);
+    check_classes(symmetric_group<3>(), 3);
+    check_classes(symmetric_group<4>(), 5);
+    check_classes(symmetric_group<5>(), 7);
+    check_classes(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})}), 5); // D4
+    check_classes(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}), 4);     // A4
+    check_classes(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})}), 6); // D6
+
+    const auto group = test::cyclic_group(4);
+    CHECK_THROWS((ConjugacyClasses<int, test::AddMod>(group).members(4)), std::out_of_range);
+
+    return test::finish();
+}
@@ -0,0 +1,167 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Смежный класс по определению: g ∘ H или H ∘ g
+ */
+template<typename T, typename Op>
+Set<T> naive_coset(const Group<T, Op>& group, const Set<T>& subgroup, const T& g, bool left) {
+    Set<T> result;
+    for (const auto& h : subgroup) {
+        result.insert(left ? group.operate_unchecked(g, h) : group.operate_unchecked(h, g));
+    }
+    return result;
+}
+
+template<typename T, typename Op>
+void check_table(const Group<T, Op>& group, const Subgroup<T, Op>& subgroup, bool left) {
+    using CosetType = typename Coset<T, Op>::CosetType;
+    const CosetType type = left ? CosetType::LEFT : CosetType::RIGHT;
+    const CosetTable<T, Op> table(group, subgroup, type);
+    const Set<T>& elements = group.get_set();
+
+    Set<Set<T>> expected;
+    for (const auto& g : elements) {
+        expected.insert(naive_coset(group, subgroup.get_subset(), g, left));
+    }
+    CHECK(table.index() == expected.size());
+    CHECK(table.index() * subgroup.size() == elements.size());
+
+    const std::vector<Set<T>> sets = table.coset_sets();
+    CHECK(Set<Set<T>>(sets.begin(), sets.end()) == expected);
+    CHECK((CosetPartition<T, Op>::verify_partition(group, expected)));
+    CHECK((left ? CosetPartition<T, Op>::left_coset_partition(group, subgroup)
+                : CosetPartition<T, Op>::right_coset_partition(group, subgroup)) == expected);
+
+    const std::vector<Coset<T, Op>> cosets = table.cosets();
+    for (size_t c = 0; c < table.index(); ++c) {
+        const Coset<T, Op>& coset = cosets[c];
+        CHECK(coset.label() == c);
+        CHECK(coset.type() == type);
+        CHECK(coset.get_coset() == sets[c]);
+        CHECK(table.representative_indices()[c] == group.index_of(table.representative(c)));
+        // Представитель - элемент класса с наименьшим индексом
+        for (const auto& x : sets[c]) {
+            CHECK(group.index_of(table.representative(c)) <= group.index_of(x));
+        }
+
+        // Принадлежность по номеру совпадает с проверкой через подгруппу
+        const Coset<T, Op> plain(group, subgroup, table.representative(c), type);
+        CHECK(!plain.label().has_value());
+        for (const auto& x : elements) {
+            CHECK(coset.contains(x) == sets[c].contains(x));
+            CHECK(plain.contains(x) == sets[c].contains(x));
+            CHECK(table.same_coset(x, table.representative(c)) == sets[c].contains(x));
+        }
+        for (size_t d = 0; d < table.index(); ++d) {
+            CHECK((coset == cosets[d]) == (c == d));
+            CHECK((plain == cosets[d]) == (c == d));
+        }
+    }
+    for (const auto& g : elements) {
+        CHECK(sets[table.label_of(g)].contains(g));
+    }
+    CHECK_THROWS(table.representative(table.index()), std::out_of_range);
+}
+
+template<typename T, typename Op>
+void check_cosets(const Group<T, Op>& group) {
+    std::vector<Subgroup<T, Op>> subgroups;
+    for (const auto& subset : test::naive_subgroups(group)) {
+        subgroups.emplace_back(group, subset);
+    }
+
+    for (const auto& subgroup : subgroups) {
+        check_table(group, subgroup, true);
+        check_table(group, subgroup, false);
+        CHECK((LagrangesTheorem<T, Op>::verify(group, subgroup)));
+        CHECK((LagrangesTheorem<T, Op>::compute_index(group, subgroup) * subgroup.size() ==
+               group.get_set().size()));
+
+        if (!NormalSubgroup<T, Op>::is_normal(subgroup)) {
+            continue;
+        }
+
+        // Фактор-группа: операции на номерах классов против (a ∘ b) ∘ N
+        const NormalSubgroup<T, Op> normal(subgroup, trusted_subgroup);
+        const FactorGroup<T, Op> factor(group, normal);
+        const Set<T>& n = normal.get_subset();
+        CHECK(factor.size() * n.size() == group.get_set().size());
+        CHECK(factor.identity() == n);
+        CHECK(factor.verify_factor_group());
+
+        Set<Set<T>> expected;
+        for (const auto& g : group.get_set()) {
+            expected.insert(naive_coset(group, n, g, true));
+            CHECK(factor.coset_of(g).get_coset() == naive_coset(group, n, g, true));
+        }
+        CHECK(factor.get_cosets() == expected);
+
+        for (const auto& a : factor.cosets()) {
+            const Set<T>& a_set = a.get_coset();
+            CHECK(factor.inverse(a_set) == naive_coset(group, n, group.inverse(a.representative()), true));
+            for (const auto& b : factor.cosets()) {
+                const T product = group.operate_unchecked(a.representative(), b.representative());
+                CHECK(factor.operate(a_set, b.get_coset()) == naive_coset(group, n, product, true));
+                CHECK(factor.get_operation()(a_set, b.get_coset()) == naive_coset(group, n, product, true));
+            }
+        }
+
+        // Множества, не являющиеся классами N, отвергаются
+        if (n.size() < group.get_set().size()) {
+            CHECK_THROWS(factor.inverse(group.get_set()), std::domain_error);
+            const Set<T> mixed = naive_coset(group, n, *factor.cosets()[1].begin(), true) + Set<T>{group.identity()};
+            CHECK_THROWS(factor.operate(mixed, n), std::domain_error);
+        }
+        if (n.size() > 1) {
+            CHECK_THROWS(factor.inverse(Set<T>{group.identity()}), std::domain_error);
+        }
+    }
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_cosets(test::cyclic_group(12));
+    check_cosets(symmetric_group<3>());
+    check_cosets(symmetric_group<4>());
+    check_cosets(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})})); // D4
+    check_cosets(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})})); // D6
+
+    // Разбиение с пересекающимися или неполными классами
+    const auto z6 = test::cyclic_group(6);
+    CHECK(!(CosetPartition<int, test::AddMod>::verify_partition(z6, Set<Set<int>>{{0, 3}, {1, 4}, {2, 5, 3}})));
+    CHECK(!(CosetPartition<int, test::AddMod>::verify_partition(z6, Set<Set<int>>{{0, 3}, {1, 4}})));
+    CHECK(!(CosetPartition<int, test::AddMod>::verify_partition(z6, Set<Set<int>>{{0, 3}, {1, 4}, {2, 5, 7}})));
+
+    // Классы разделяют разметку с таблицей и переживают её и фактор-группу
+    const auto z12 = test::cyclic_group(12);
+    const NormalSubgroup<int, test::AddMod> multiples(z12, Set<int>{0, 3, 6, 9});
+    const auto view = FactorGroup<int, test::AddMod>(z12, multiples).coset_of(4);
+    CHECK(view.contains(1) && view.contains(10) && !view.contains(3));
+    CHECK(view.label().has_value());
+    std::vector<FactorGroup<int, test::AddMod>> factors;
+    std::vector<Coset<int, test::AddMod>> views;
+    for (int i = 0; i < 8; ++i) {
+        factors.emplace_back(z12, multiples); // Перераспределение перемещает таблицы
+        views.push_back(factors.back().coset_of(i));
+    }
+    factors.clear();
+    for (int i = 0; i < 8; ++i) {
+        CHECK(views[static_cast<size_t>(i)].contains((i + 3) % 12));
+        CHECK(!views[static_cast<size_t>(i)].contains((i + 1) % 12));
+    }
+
+    // Подгруппа другой группы
+    const auto other = test::cyclic_group(6);
+    const Subgroup<int, test::AddMod> foreign(other, Set<int>{0, 3});
+    CHECK_THROWS((CosetTable<int, test::AddMod>(z6, foreign)), std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,101 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Двойной класс по определению: {h ∘ g ∘ k | h ∈ H, k ∈ K}
+ */
+template<typename T, typename Op>
+Set<T> naive_double_coset(const Group<T, Op>& group, const Set<T>& left, const T& g, const Set<T>& right) {
+    Set<T> result;
+    for (const auto& h : left) {
+        const T hg = group.operate_unchecked(h, g);
+        for (const auto& k : right) {
+            result.insert(group.operate_unchecked(hg, k));
+        }
+    }
+    return result;
+}
+
+template<typename T, typename Op>
+void check_double_cosets(const Group<T, Op>& group) {
+    using SubgroupType = Subgroup<T, Op>;
+    std::vector<SubgroupType> subgroups;
+    for (const auto& subset : test::naive_subgroups(group)) {
+        subgroups.emplace_back(group, subset);
+    }
+
+    for (const auto& left : subgroups) {
+        for (const auto& right : subgroups) {
+            const DoubleCosets<T, Op> cosets(group, left, right);
+
+            Set<Set<T>> expected;
+            for (const auto& g : group.get_set()) {
+                const Set<T> coset = naive_double_coset(group, left.get_subset(), g, right.get_subset());
+                expected.insert(coset);
+                CHECK(cosets.double_coset_set(cosets.label_of(g)) == coset);
+            }
+            CHECK(cosets.count() == expected.size());
+            CHECK(cosets.verify_partition());
+
+            Set<Set<T>> found;
+            size_t entries = 0;
+            for (const auto& entry : cosets) {
+                const size_t d = entry.index;
+                CHECK(d == entries++);
+                const Set<T> coset = cosets.double_coset_set(d);
+                found.insert(coset);
+                CHECK(entry.size == coset.size());
+                CHECK(cosets.size(d) == coset.size());
+                CHECK(cosets.right_cosets(d).size() * right.size() == coset.size());
+
+                // Представитель - элемент класса с наименьшим индексом
+                CHECK(entry.representative == cosets.representative(d));
+                CHECK(coset.contains(entry.representative));
+                for (const auto& x : coset) {
+                    CHECK(group.index_of(entry.representative) <= group.index_of(x));
+                    CHECK(cosets.label_of(x) == d);
+                    CHECK(cosets.same_double_coset(entry.representative, x));
+                }
+
+                size_t visited = 0;
+                Set<T> streamed;
+                cosets.for_each_element(d, [&](const T& x) {
+                    ++visited;
+                    streamed.insert(x);
+                });
+                CHECK(visited == coset.size());
+                CHECK(streamed == coset);
+            }
+            CHECK(found == expected);
+            CHECK_THROWS(cosets.representative(cosets.count()), std::out_of_range);
+        }
+    }
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_double_cosets(test::cyclic_group(12));
+    check_double_cosets(symmetric_group<3>());
+    check_double_cosets(symmetric_group<4>());
+    check_double_cosets(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})})); // D4
+    check_double_cosets(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}));     // A4
+    check_double_cosets(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})})); // D6
+
+    // Подгруппы другой группы
+    using S3 = Subgroup<Permutation<3>, PermutationComposition>;
+    const auto s3 = symmetric_group<3>();
+    const auto other = symmetric_group<3>();
+    const S3 whole(s3, s3.get_set());
+    const S3 foreign(other, other.get_set());
+    CHECK_THROWS((DoubleCosets<Permutation<3>, PermutationComposition>(s3, whole, foreign)), std::domain_error);
+    CHECK_THROWS((DoubleCosets<Permutation<3>, PermutationComposition>(s3, foreign, whole)), std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,109 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Классы эквивалентности по определению: [a] = {b | (a, b) ∈ R}
+ */
+template<typename T>
+Set<Set<T>> naive_classes(const Relation<T>& relation) {
+    Set<Set<T>> result;
+    for (const auto& a : relation.get_set()) {
+        Set<T> equivalence_class;
+        for (const auto& b : relation.get_set()) {
+            if (relation.related(a, b)) {
+                equivalence_class.insert(b);
+            }
+        }
+        result.insert(equivalence_class);
+    }
+    return result;
+}
+
+template<typename T>
+void check_partition(const Relation<T>& relation) {
+    const Set<Set<T>> expected = naive_classes(relation);
+    CHECK(relation.equivalence_classes() == expected);
+    CHECK(relation.quotient_set() == expected);
+
+    const EquivalencePartition<T>& partition = relation.equivalence_partition();
+    CHECK(partition.class_count() == expected.size());
+    for (const auto& a : relation.get_set()) {
+        Set<T> expected_class;
+        for (const auto& b : relation.get_set()) {
+            if (relation.related(a, b)) {
+                expected_class.insert(b);
+            }
+        }
+        CHECK(relation.equivalence_class(a) == expected_class);
+        CHECK(partition.class_set(partition.class_of(a)) == expected_class);
+        CHECK(partition.class_size(partition.class_of(a)) == expected_class.size());
+        for (const auto& b : relation.get_set()) {
+            CHECK(partition.equivalent(a, b) == relation.related(a, b));
+        }
+    }
+}
+
+int main() {
+    // Сравнения по модулю: плотные отношения
+    for (int modulus : {1, 2, 5, 30}) {
+        check_partition(Relation<int>(test::range_set(30),
+                                      [modulus](int a, int b) { return a % modulus == b % modulus; }));
+    }
+
+    // Разреженное отношение эквивалентности: равенство плюс несколько пар
+    Set<std::pair<int, int>> pairs;
+    for (int i = 0; i < 100; ++i) {
+        pairs.insert({i, i});
+    }
+    for (auto [a, b] : {std::pair{3, 40}, std::pair{40, 77}, std::pair{5, 6}}) {
+        pairs.insert({a, b});
+        pairs.insert({b, a});
+    }
+    pairs.insert({3, 77});
+    pairs.insert({77, 3});
+    const Relation<int> sparse(test::range_set(100), pairs);
+    CHECK(sparse.is_sparse());
+    check_partition(sparse);
+
+    // Отношение не эквивалентность: проверка включена по умолчанию
+    const Relation<int> order(test::range_set(10), [](int a, int b) { return a <= b; });
+    CHECK_THROWS(order.equivalence_classes(), std::logic_error);
+
+    // Без проверки - компоненты связности графа отношения
+    test::Lcg random{33};
+    const Relation<int> arbitrary = test::random_relation(60, 40, random);
+    const EquivalencePartition<int>& components = arbitrary.equivalence_partition(true);
+    Set<std::pair<int, int>> symmetric = arbitrary.get_pairs();
+    for (const auto& [a, b] : arbitrary.get_pairs()) {
+        symmetric.insert({b, a});
+    }
+    const Set<std::pair<int, int>> connected =
+        test::naive_closure(Relation<int>(test::range_set(60), symmetric));
+    for (int a = 0; a < 60; ++a) {
+        for (int b = 0; b < 60; ++b) {
+            CHECK(components.equivalent(a, b) == connected.contains({a, b}));
+        }
+    }
+
+    // Система непересекающихся множеств напрямую
+    DisjointSetUnion sets(10);
+    CHECK(sets.set_count() == 10);
+    CHECK(sets.unite(1, 2));
+    CHECK(sets.unite(2, 3));
+    CHECK(!sets.unite(1, 3));
+    CHECK(sets.unite(7, 8));
+    CHECK(sets.set_count() == 7);
+    CHECK(sets.same(1, 3) && !sets.same(1, 7));
+    const std::vector<size_t> labels = sets.labels();
+    CHECK(labels[1] == labels[3] && labels[7] == labels[8] && labels[0] != labels[1]);
+    for (size_t label : labels) {
+        CHECK(label < 7);
+    }
+
+    return test::finish();
+}
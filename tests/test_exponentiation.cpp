@@ -0,0 +1,109 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+using namespace cryptomath;
+using test::MulMod;
+
+/**
+ * @brief a^n прямым умножением: n операций
+ */
+template<typename MonoidType, typename T>
+T naive_power(const MonoidType& monoid, const T& a, size_t n) {
+    T result = monoid.identity();
+    for (size_t i = 0; i < n; ++i) {
+        result = monoid.operate_unchecked(result, a);
+    }
+    return result;
+}
+
+/**
+ * @brief Композиция перестановок с условным обменом, считающим свои вызовы
+ */
+struct CountingComposition {
+    size_t* swaps;
+
+    DynamicPermutation operator()(const DynamicPermutation& p, const DynamicPermutation& q) const {
+        return p * q;
+    }
+
+    void conditional_swap(DynamicPermutation& a, DynamicPermutation& b, bool bit) const {
+        ++*swaps;
+        if (bit) {
+            std::swap(a, b);
+        }
+    }
+};
+
+template<typename GroupType>
+void check_powers(const GroupType& group, size_t max_exponent) {
+    for (const auto& a : group.indexed_elements()) {
+        const FixedBasePower<typename GroupType::element_type, typename GroupType::operation_type>
+            comb(group, a, max_exponent);
+        for (size_t n = 0; n <= max_exponent; ++n) {
+            const auto expected = naive_power(group, a, n);
+            CHECK(group.power(a, static_cast<long long>(n)) == expected);
+            CHECK(group.power_ladder(a, static_cast<long long>(n)) == expected);
+            CHECK(comb(n) == expected);
+        }
+        // Отрицательные показатели: a^(-n) = (a⁻¹)^n
+        for (size_t n = 1; n <= 8; ++n) {
+            const auto expected = naive_power(group, group.inverse(a), n);
+            CHECK(group.power(a, -static_cast<long long>(n)) == expected);
+            CHECK(group.power_ladder(a, -static_cast<long long>(n)) == expected);
+        }
+    }
+}
+
+int main() {
+    // Маскированный обмен для тривиально копируемых типов
+    int x = 3;
+    int y = 7;
+    detail::masked_swap(x, y, false);
+    CHECK(x == 3 && y == 7);
+    detail::masked_swap(x, y, true);
+    CHECK(x == 7 && y == 3);
+
+    // Мультипликативная группа вычетов по модулю 101, показатели до 200
+    Set<int> units;
+    for (int i = 1; i < 101; ++i) {
+        units.insert(i);
+    }
+    const Group<int, MulMod> units_group(Monoid<int, MulMod>(units, MulMod{101}, 1));
+    check_powers(units_group, 200);
+
+    // Большие показатели: по малой теореме Ферма a^n = a^(n mod 100)
+    for (int a : {2, 3, 50, 100}) {
+        const long long n = 1'000'000'000'000'000'037LL;
+        const int expected = naive_power(units_group, a, static_cast<size_t>(n % 100));
+        CHECK(units_group.power(a, n) == expected);
+        CHECK(units_group.power_ladder(a, n) == expected);
+    }
+
+    // Неабелева группа S4
+    check_powers(symmetric_group<4>(), 30);
+
+    // Нетривиально копируемые элементы: обмен выполняется через Op::conditional_swap
+    size_t swaps = 0;
+    std::vector<DynamicPermutation> values;
+    const auto symmetric = symmetric_group<3>();
+    for (const auto& p : symmetric.indexed_elements()) {
+        values.push_back(DynamicPermutation(p));
+    }
+    const Monoid<DynamicPermutation, CountingComposition> permutations(
+        Set<DynamicPermutation>(values.begin(), values.end()), CountingComposition{&swaps},
+        DynamicPermutation(3));
+    const Group<DynamicPermutation, CountingComposition> s3(permutations);
+    const DynamicPermutation cycle = DynamicPermutation::cycle(3, {0, 1, 2});
+    for (size_t n = 0; n <= 10; ++n) {
+        swaps = 0;
+        CHECK(s3.power_ladder(cycle, static_cast<long long>(n)) == naive_power(s3, cycle, n));
+        // Один обмен на каждый бит показателя и завершающий обмен - независимо от n
+        CHECK(swaps == std::numeric_limits<size_t>::digits + 1);
+    }
+
+    return test::finish();
+}
@@ -0,0 +1,61 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace cryptomath;
+
+template<typename T, typename Op>
+void check_generated(const Group<T, Op>& group, test::Lcg& random) {
+    const std::vector<T>& elements = group.indexed_elements();
+    for (size_t trial = 0; trial < 200; ++trial) {
+        std::vector<T> seeds;
+        for (size_t count = random.next() % 5; seeds.size() < count;) {
+            seeds.push_back(elements[random.next() % elements.size()]);
+        }
+        const Set<T> expected = test::generated_set(group, Set<T>(seeds.begin(), seeds.end()));
+        const Subgroup<T, Op> subgroup = Subgroup<T, Op>::generated_by(group, seeds);
+        CHECK(subgroup.get_subset() == expected);
+
+        // Порождающие - подпоследовательность seeds, каждый расширяет подгруппу предыдущих
+        const std::vector<T>& generators = subgroup.generators();
+        size_t position = 0;
+        Set<T> previous{group.identity()};
+        for (const auto& g : generators) {
+            while (position < seeds.size() && !(seeds[position] == g)) {
+                ++position;
+            }
+            CHECK(position < seeds.size());
+            CHECK(!previous.contains(g));
+            previous = test::generated_set(group, previous + Set<T>{g});
+        }
+        CHECK(previous == expected);
+    }
+
+    // Лениво вычисленные порождающие подгруппы, заданной множеством
+    for (const auto& subset : test::naive_subgroups(group)) {
+        const Subgroup<T, Op> subgroup(group, subset);
+        const std::vector<T>& generators = subgroup.generators();
+        CHECK(test::generated_set(group, Set<T>(generators.begin(), generators.end())) == subset);
+        CHECK((size_t{1} << generators.size()) <= subset.size());
+    }
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+    test::Lcg random{45};
+
+    check_generated(test::cyclic_group(12), random);
+    check_generated(test::units_group(15), random);
+    check_generated(symmetric_group<4>(), random);
+    check_generated(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}), random);     // A4
+    check_generated(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})}), random); // D6
+
+    // Элемент вне группы
+    const auto z12 = test::cyclic_group(12);
+    CHECK_THROWS((Subgroup<int, test::AddMod>::generated_by(z12, {2, 20})), std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,88 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <vector>
+
+using namespace cryptomath;
+using test::AddMod;
+
+/**
+ * @brief Сравнить гомоморфизм с явной формулой и проверить его определения перебором
+ */
+template<typename T, typename Op, typename U, typename OpU, typename Formula>
+void check_homomorphism(const GroupHomomorphism<T, Op, U, OpU>& phi, Formula formula) {
+    const Group<T, Op>& source = phi.source();
+    const Group<U, OpU>& target = phi.target();
+
+    Set<T> kernel;
+    Set<U> image;
+    for (const auto& x : source.get_set()) {
+        CHECK(phi(x) == formula(x));
+        if (formula(x) == target.identity()) {
+            kernel.insert(x);
+        }
+        image.insert(formula(x));
+        for (const auto& y : source.get_set()) {
+            CHECK(phi(source.operate(x, y)) == target.operate(phi(x), phi(y)));
+        }
+    }
+
+    CHECK(phi.kernel().get_subset() == kernel);
+    CHECK(phi.image().get_subset() == image);
+    CHECK(phi.is_injective() == (kernel.size() == 1));
+    CHECK(phi.is_surjective() == (image == target.get_set()));
+    CHECK(phi.is_isomorphism() == (kernel.size() == 1 && image == target.get_set()));
+    CHECK(phi.verify_first_isomorphism());
+    // |G| = |ker φ| · |im φ|
+    CHECK(source.get_set().size() == kernel.size() * image.size());
+}
+
+int main() {
+    const auto z12 = test::cyclic_group(12);
+    const auto z4 = test::cyclic_group(4);
+    const auto z8 = test::cyclic_group(8);
+
+    // Все эндоморфизмы Z_12: 1 ↦ k задаёт x ↦ k·x
+    for (int k = 0; k < 12; ++k) {
+        const GroupHomomorphism<int, AddMod, int, AddMod> phi(z12, z12, {1}, {k});
+        check_homomorphism(phi, [k](int x) { return k * x % 12; });
+    }
+
+    // Z_12 → Z_4 и Z_12 → Z_8: образ 1 должен иметь порядок, делящий 12
+    check_homomorphism(GroupHomomorphism<int, AddMod, int, AddMod>(z12, z4, {1}, {3}),
+                       [](int x) { return 3 * x % 4; });
+    check_homomorphism(GroupHomomorphism<int, AddMod, int, AddMod>(z12, z8, {1}, {2}),
+                       [](int x) { return 2 * x % 8; });
+    CHECK_THROWS((GroupHomomorphism<int, AddMod, int, AddMod>(z12, z8, {1}, {1})), std::invalid_argument);
+
+    // Несколько порождающих, включая избыточные соотношения
+    check_homomorphism(GroupHomomorphism<int, AddMod, int, AddMod>(z12, z4, {3, 4}, {1, 0}),
+                       [](int x) { return 3 * x % 4; });
+    CHECK_THROWS((GroupHomomorphism<int, AddMod, int, AddMod>(z12, z4, {3, 4}, {1, 1})),
+                 std::invalid_argument);
+
+    // Знак перестановки S4 → Z_2 по числу инверсий
+    using P4 = Permutation<4>;
+    const auto s4 = symmetric_group<4>();
+    const auto z2 = test::cyclic_group(2);
+    const GroupHomomorphism<P4, PermutationComposition, int, AddMod> sign(
+        s4, z2, {P4::cycle({0, 1}), P4::cycle({0, 1, 2, 3})}, {1, 1});
+    check_homomorphism(sign, [](const P4& p) {
+        int inversions = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = i + 1; j < 4; ++j) {
+                inversions += p(i) > p(j) ? 1 : 0;
+            }
+        }
+        return inversions % 2;
+    });
+    CHECK(sign.kernel().get_subset().size() == 12);
+
+    // Ошибки: элементы не порождают группу, разные длины списков, элементы вне групп
+    CHECK_THROWS((GroupHomomorphism<int, AddMod, int, AddMod>(z12, z4, {2}, {0})), std::invalid_argument);
+    CHECK_THROWS((GroupHomomorphism<int, AddMod, int, AddMod>(z12, z4, {1}, {})), std::invalid_argument);
+    CHECK_THROWS((GroupHomomorphism<int, AddMod, int, AddMod>(z12, z4, {13}, {0})), std::domain_error);
+    CHECK_THROWS((GroupHomomorphism<int, AddMod, int, AddMod>(z12, z4, {1}, {5})), std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,49 @@
+#include "test_common.hpp"
+
+using namespace cryptomath;
+using test::MulMod;
+
+/**
+ * @brief Обратный элемент прямым перебором: b с a ∘ b = e
+ */
+template<typename GroupType, typename T>
+T brute_force_inverse(const GroupType& group, const T& a) {
+    for (const auto& b : group.get_set()) {
+        if (group.operate_unchecked(a, b) == group.identity()) {
+            return b;
+        }
+    }
+    return group.identity();
+}
+
+template<typename GroupType>
+void check_inverse_table(const GroupType& group) {
+    const auto& elements = group.indexed_elements();
+    for (size_t i = 0; i < elements.size(); ++i) {
+        const auto expected = brute_force_inverse(group, elements[i]);
+        CHECK(group.inverse(elements[i]) == expected);
+        CHECK(group.element_at(group.inverse_index(i)) == expected);
+        CHECK(group.inverse_index(group.inverse_index(i)) == i);
+    }
+}
+
+int main() {
+    check_inverse_table(test::cyclic_group(12));
+
+    // Мультипликативная группа вычетов по простому модулю 101
+    Set<int> units;
+    for (int i = 1; i < 101; ++i) {
+        units.insert(i);
+    }
+    const Monoid<int, MulMod> monoid(units, MulMod{101}, 1);
+    check_inverse_table(Group<int, MulMod>(monoid));
+
+    // Неабелева группа S4
+    check_inverse_table(symmetric_group<4>());
+
+    // Элемент вне группы
+    const auto group = test::cyclic_group(7);
+    CHECK_THROWS(group.inverse(7), std::domain_error);
+
+    return test::finish();
+}
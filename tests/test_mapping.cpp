@@ -0,0 +1,77 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Сравнить отображение с функцией, по которой оно построено
+ */
+void check_mapping(const Set<int>& domain, const Set<int>& codomain, const std::function<int(int)>& f) {
+    const Mapping<int, int> mapping(domain, codomain, f);
+
+    std::map<int, int> expected_map;
+    Set<int> image;
+    for (int x : domain) {
+        CHECK(mapping(x) == f(x));
+        expected_map[x] = f(x);
+        image.insert(f(x));
+    }
+    CHECK(mapping.to_map() == expected_map);
+    CHECK(mapping.image() == image);
+    CHECK((mapping == Mapping<int, int>(domain, codomain, expected_map)));
+
+    const bool injective = image.size() == domain.size();
+    const bool surjective = image == codomain;
+    CHECK(mapping.is_injective() == injective);
+    CHECK(mapping.is_surjective() == surjective);
+    CHECK(mapping.is_bijective() == (injective && surjective));
+
+    if (injective && surjective) {
+        const Mapping<int, int> inverse = mapping.inverse();
+        for (int x : domain) {
+            CHECK(inverse(f(x)) == x);
+        }
+        CHECK(mapping.compose(inverse) == identity_mapping(domain));
+    } else {
+        CHECK_THROWS(mapping.inverse(), std::logic_error);
+    }
+
+    // Композиция с отображением codomain → codomain: y ↦ 3y + 1
+    const int n = static_cast<int>(codomain.size());
+    const Mapping<int, int> g(codomain, codomain, [n](int y) { return (3 * y + 1) % n; });
+    const Mapping<int, int> composed = g * mapping;
+    for (int x : domain) {
+        CHECK(composed(x) == (3 * f(x) + 1) % n);
+    }
+}
+
+int main() {
+    const Set<int> z12 = test::range_set(12);
+    const Set<int> z6 = test::range_set(6);
+    for (int a : {1, 5, 2, 3, 0}) {
+        check_mapping(z12, z12, [a](int x) { return (a * x + 7) % 12; });
+    }
+    check_mapping(z12, z12, [](int x) { return x * x % 12; });
+    check_mapping(z12, z6, [](int x) { return x % 6; });
+    check_mapping(z6, z12, [](int x) { return 2 * x; });
+    check_mapping(Set<int>{}, z6, [](int x) { return x; });
+
+    // Таблица индексов и её проверки
+    const Mapping<int, int> doubling = Mapping<int, int>::from_table(z6, z12, {0, 2, 4, 6, 8, 10});
+    CHECK(doubling(5) == 10 && doubling.apply_index(3) == 6);
+    CHECK_THROWS((Mapping<int, int>::from_table(z6, z12, {0, 1})), std::invalid_argument);
+    CHECK_THROWS((Mapping<int, int>::from_table(z6, z6, {0, 1, 2, 3, 4, 6})), std::invalid_argument);
+
+    // Ошибки построения и вычисления
+    CHECK_THROWS((Mapping<int, int>(z12, z6, [](int x) { return x; })), std::invalid_argument);
+    CHECK_THROWS((Mapping<int, int>(z6, z6, std::map<int, int>{{0, 0}})), std::invalid_argument);
+    CHECK_THROWS((Mapping<int, int>(z6, z6, std::map<int, int>{{9, 0}})), std::invalid_argument);
+    CHECK_THROWS(doubling(6), std::domain_error);
+    CHECK_THROWS(doubling.compose(doubling), std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,78 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using namespace cryptomath;
+using test::MulMod;
+
+/**
+ * @brief ∏ gᵢ^eᵢ как произведение отдельных степеней
+ */
+template<typename GroupType, typename T>
+T product_of_powers(const GroupType& group, const std::vector<T>& bases,
+                    const std::vector<long long>& exponents) {
+    T result = group.identity();
+    for (size_t i = 0; i < bases.size(); ++i) {
+        result = group.operate_unchecked(result, group.power(bases[i], exponents[i]));
+    }
+    return result;
+}
+
+template<typename GroupType>
+void check_multi_power(const GroupType& group, test::Lcg& random) {
+    const auto& elements = group.indexed_elements();
+    // Размеры по обе стороны порога переключения Страус → Пиппенджер
+    for (size_t count : {0, 1, 2, 3, 5, 8, 31, 32, 33, 64, 200}) {
+        for (long long range : {3LL, 1000LL, 1LL << 40}) {
+            std::vector<typename GroupType::element_type> bases;
+            std::vector<long long> exponents;
+            for (size_t i = 0; i < count; ++i) {
+                bases.push_back(elements[random.next() % elements.size()]);
+                exponents.push_back(static_cast<long long>(random.next() % (2 * range + 1)) - range);
+            }
+            CHECK(group.multi_power(bases, exponents) == product_of_powers(group, bases, exponents));
+        }
+    }
+}
+
+int main() {
+    test::Lcg random{2024};
+
+    check_multi_power(test::cyclic_group(12), random);
+
+    Set<int> units;
+    for (int i = 1; i < 101; ++i) {
+        units.insert(i);
+    }
+    const Group<int, MulMod> units_group(Monoid<int, MulMod>(units, MulMod{101}, 1));
+    check_multi_power(units_group, random);
+
+    // Оба метода напрямую на одних и тех же данных, включая показатели во всю ширину size_t
+    const MulMod mul{101};
+    for (size_t count : {1, 4, 31, 32, 100}) {
+        std::vector<int> bases;
+        std::vector<size_t> exponents;
+        int expected = 1;
+        for (size_t i = 0; i < count; ++i) {
+            bases.push_back(static_cast<int>(1 + random.next() % 100));
+            exponents.push_back(i == 0 ? std::numeric_limits<size_t>::max()
+                                       : static_cast<size_t>(random.next() * random.next()));
+            // По малой теореме Ферма показатель можно взять по модулю 100
+            for (size_t k = 0; k < exponents.back() % 100; ++k) {
+                expected = mul(expected, bases.back());
+            }
+        }
+        CHECK(detail::straus_multi_power(1, bases, exponents, mul) == expected);
+        CHECK(detail::pippenger_multi_power(1, bases, exponents, mul) == expected);
+    }
+
+    // Несогласованные длины и элементы вне группы
+    const auto z12 = test::cyclic_group(12);
+    CHECK_THROWS(z12.multi_power({1, 2}, {1}), std::invalid_argument);
+    CHECK_THROWS(z12.multi_power({1, 20}, {1, 1}), std::domain_error);
+    CHECK_THROWS(z12.multi_power({1, 20}, {1, -1}), std::domain_error);
+
+    return test::finish();
+}
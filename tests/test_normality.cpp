@@ -0,0 +1,73 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+
+using namespace cryptomath;
+
+/**
+ * @brief Нормальность по определению: g ∘ n ∘ g⁻¹ ∈ N для всех g ∈ G и n ∈ N
+ */
+template<typename T, typename Op>
+bool naive_is_normal(const Group<T, Op>& group, const Set<T>& subset) {
+    for (const auto& g : group.get_set()) {
+        const T g_inverse = group.inverse(g);
+        for (const auto& n : subset) {
+            if (!subset.contains(group.operate_unchecked(group.operate_unchecked(g, n), g_inverse))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T, typename Op>
+void check_normality(const Group<T, Op>& group, size_t expected_subgroups, size_t expected_normal) {
+    const Set<Set<T>> subgroups = test::naive_subgroups(group);
+    CHECK(subgroups.size() == expected_subgroups);
+
+    const ConjugacyClasses<T, Op> classes(group);
+    size_t normal_count = 0;
+    for (const auto& subset : subgroups) {
+        const bool expected = naive_is_normal(group, subset);
+        normal_count += expected ? 1 : 0;
+
+        const Subgroup<T, Op> subgroup(group, subset);
+        CHECK((NormalSubgroup<T, Op>::is_normal(subgroup) == expected));
+        CHECK(classes.is_normal(subgroup) == expected);
+
+        const NormalSubgroup<T, Op> unchecked(subgroup, trusted_subgroup);
+        CHECK(unchecked.verify_normal() == expected);
+        CHECK(unchecked.verify_normal_via_cosets() == expected);
+
+        if (expected) {
+            CHECK((NormalSubgroup<T, Op>(subgroup).get_subset() == subset));
+            CHECK((NormalSubgroup<T, Op>(group, subset).get_subset() == subset));
+        } else {
+            CHECK_THROWS((NormalSubgroup<T, Op>{subgroup}), std::invalid_argument);
+            CHECK_THROWS((NormalSubgroup<T, Op>{group, subset}), std::invalid_argument);
+        }
+    }
+    CHECK(normal_count == expected_normal);
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_normality(test::cyclic_group(12), 6, 6);
+    check_normality(symmetric_group<3>(), 6, 3);
+    check_normality(symmetric_group<4>(), 30, 4);
+    check_normality(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})}), 10, 6); // D4
+    check_normality(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}), 10, 3);     // A4
+    check_normality(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})}), 16, 7); // D6
+
+    // Подгруппа другой группы
+    const auto s3 = symmetric_group<3>();
+    const auto other = symmetric_group<3>();
+    const Subgroup<Permutation<3>, PermutationComposition> foreign(other, other.get_set());
+    CHECK_THROWS((ConjugacyClasses<Permutation<3>, PermutationComposition>(s3).is_normal(foreign)),
+                 std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,93 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Случайная перестановка {0, ..., n - 1} (тасование Фишера–Йетса)
+ */
+std::vector<size_t> random_images(size_t n, test::Lcg& random) {
+    std::vector<size_t> images(n);
+    std::iota(images.begin(), images.end(), size_t{0});
+    for (size_t i = n; i > 1; --i) {
+        std::swap(images[i - 1], images[random.next() % i]);
+    }
+    return images;
+}
+
+/**
+ * @brief Сравнить векторную композицию Permutation<N> со скалярной выборкой p(q(i))
+ */
+template<size_t N>
+void check_degree(test::Lcg& random) {
+    using P = Permutation<N>;
+    for (size_t trial = 0; trial < 50; ++trial) {
+        const std::vector<size_t> p_images = random_images(N, random);
+        const std::vector<size_t> q_images = random_images(N, random);
+        const P p(p_images);
+        const P q(q_images);
+        const P product = p * q;
+
+        bool composed = true;
+        bool padding_kept = true;
+        for (size_t i = 0; i < N; ++i) {
+            composed = composed && product(i) == p_images[q_images[i]];
+        }
+        for (size_t i = N; i < P::padded_degree; ++i) {
+            padding_kept = padding_kept && product.data()[i] == i;
+        }
+        CHECK(composed);
+        CHECK(padding_kept);
+
+        // Скалярная композиция DynamicPermutation даёт те же образы
+        const DynamicPermutation dynamic = DynamicPermutation(p) * DynamicPermutation(q);
+        CHECK(dynamic == DynamicPermutation(product));
+
+        CHECK(p * P::inverse(p) == P::identity());
+        CHECK(P::inverse(p) * p == P::identity());
+
+        // Порядок - наименьшее k > 0 с p^k = e; для больших N порядок
+        // случайной перестановки слишком велик для перебора степеней
+        if constexpr (N <= 20) {
+            size_t order = 1;
+            for (P power = p; !(power == P::identity()); power = power * p) {
+                ++order;
+            }
+            CHECK(p.order() == order);
+        }
+        CHECK(DynamicPermutation(p).order() == p.order());
+    }
+}
+
+int main() {
+    test::Lcg random{39};
+    // Степени по обе стороны границ 16-байтного и 32-байтного блока
+    check_degree<1>(random);
+    check_degree<3>(random);
+    check_degree<15>(random);
+    check_degree<16>(random);
+    check_degree<17>(random);
+    check_degree<31>(random);
+    check_degree<32>(random);
+    check_degree<33>(random);
+    check_degree<64>(random);
+    check_degree<100>(random);
+    check_degree<128>(random);
+
+    CHECK_THROWS(Permutation<4>({0, 1, 1, 2}), std::invalid_argument);
+    CHECK_THROWS(Permutation<4>({0, 1, 2}), std::invalid_argument);
+    CHECK_THROWS(Permutation<4>::cycle({0, 4}), std::invalid_argument);
+    CHECK_THROWS(Permutation<4>::cycle({1, 1}), std::invalid_argument);
+    CHECK_THROWS(Permutation<4>::cycle({0, 2, 3, 2}), std::invalid_argument);
+    CHECK_THROWS(DynamicPermutation::cycle(5, {1, 1}), std::invalid_argument);
+    CHECK_THROWS(DynamicPermutation::cycle(5, {0, 3, 0}), std::invalid_argument);
+    CHECK_THROWS(DynamicPermutation::cycle(5, {0, 5}), std::invalid_argument);
+    CHECK_THROWS(DynamicPermutation({0, 2}), std::invalid_argument);
+    CHECK_THROWS(DynamicPermutation(3) * DynamicPermutation(4), std::domain_error);
+
+    return test::finish();
+}
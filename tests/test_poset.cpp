@@ -0,0 +1,137 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Наибольшая антицепь полным перебором подмножеств (до 20 элементов)
+ */
+size_t naive_width(const PartialOrder<int>& order) {
+    const std::vector<int>& elements = order.relation().indexed_elements();
+    size_t best = 0;
+    for (size_t mask = 1; mask < (size_t{1} << elements.size()); ++mask) {
+        std::vector<int> chosen;
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (mask >> i & 1) {
+                chosen.push_back(elements[i]);
+            }
+        }
+        bool antichain = true;
+        for (size_t i = 0; antichain && i < chosen.size(); ++i) {
+            for (size_t j = i + 1; antichain && j < chosen.size(); ++j) {
+                antichain = !order.comparable(chosen[i], chosen[j]);
+            }
+        }
+        if (antichain && chosen.size() > best) {
+            best = chosen.size();
+        }
+    }
+    return best;
+}
+
+void check_order(const Relation<int>& relation, bool brute_force_width) {
+    const PartialOrder<int> order(relation);
+    const Set<int>& set = relation.get_set();
+
+    // Отношение покрытия и экстремальные элементы по определению
+    Set<std::pair<int, int>> covers;
+    Set<int> minimal;
+    Set<int> maximal;
+    for (int a : set) {
+        bool is_minimal = true;
+        bool is_maximal = true;
+        for (int b : set) {
+            is_minimal = is_minimal && !order.less(b, a);
+            is_maximal = is_maximal && !order.less(a, b);
+            if (!order.less(a, b)) {
+                continue;
+            }
+            bool between = false;
+            for (int c : set) {
+                between = between || (order.less(a, c) && order.less(c, b));
+            }
+            if (!between) {
+                covers.insert({a, b});
+            }
+        }
+        if (is_minimal) {
+            minimal.insert(a);
+        }
+        if (is_maximal) {
+            maximal.insert(a);
+        }
+    }
+    CHECK(order.covering_relation().get_pairs() == covers);
+    CHECK(order.minimal_elements() == minimal);
+    CHECK(order.maximal_elements() == maximal);
+    for (const auto& [a, b] : covers) {
+        CHECK(order.covers(a, b));
+    }
+
+    // Линейное расширение: перестановка множества, согласованная с порядком
+    const std::vector<int> extension = order.linear_extension();
+    CHECK(Set<int>(extension.begin(), extension.end()) == set && extension.size() == set.size());
+    for (size_t i = 0; i < extension.size(); ++i) {
+        for (size_t j = i + 1; j < extension.size(); ++j) {
+            CHECK(!order.less(extension[j], extension[i]));
+        }
+    }
+
+    // Разбиение на цепи: каждый элемент ровно в одной цепи, число цепей - ширина
+    const std::vector<std::vector<int>> chains = order.chain_decomposition();
+    CHECK(chains.size() == order.width());
+    size_t covered = 0;
+    Set<int> seen;
+    for (const auto& chain : chains) {
+        for (size_t i = 0; i < chain.size(); ++i) {
+            seen.insert(chain[i]);
+            ++covered;
+            if (i > 0) {
+                CHECK(order.less(chain[i - 1], chain[i]));
+            }
+        }
+    }
+    CHECK(seen == set && covered == set.size());
+    if (brute_force_width) {
+        CHECK(order.width() == naive_width(order));
+    }
+}
+
+int main() {
+    // Делимость на {1, ..., 16} и {1, ..., 60}
+    for (int n : {16, 60}) {
+        Set<int> numbers;
+        for (int i = 1; i <= n; ++i) {
+            numbers.insert(i);
+        }
+        check_order(Relation<int>(numbers, [](int a, int b) { return b % a == 0; }), n <= 20);
+    }
+
+    // Булеан 4-элементного множества: подмножества как битовые маски
+    check_order(Relation<int>(test::range_set(16), [](int a, int b) { return (a & ~b) == 0; }), true);
+
+    // Цепь и антицепь
+    check_order(Relation<int>(test::range_set(12), [](int a, int b) { return a <= b; }), true);
+    check_order(Relation<int>(test::range_set(12), [](int a, int b) { return a == b; }), true);
+
+    // Случайные порядки: замыкание случайного графа с дугами a → b только при a < b
+    test::Lcg random{35};
+    for (size_t pair_count : {5, 20, 60}) {
+        Set<std::pair<int, int>> pairs;
+        for (size_t k = 0; k < pair_count; ++k) {
+            const int a = static_cast<int>(random.next() % 14);
+            const int b = static_cast<int>(random.next() % 14);
+            pairs.insert({std::min(a, b), std::max(a, b)});
+        }
+        check_order(Relation<int>(test::range_set(14), pairs).transitive_closure(), true);
+    }
+
+    // Отношение, не являющееся порядком
+    CHECK_THROWS(PartialOrder<int>(Relation<int>(test::range_set(5), [](int, int) { return true; })),
+                 std::logic_error);
+
+    return test::finish();
+}
@@ -0,0 +1,66 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Сравнить прообразы из обратного индекса с перебором области определения
+ */
+void check_preimages(const Set<int>& domain, const Set<int>& codomain, const std::function<int(int)>& f) {
+    const Mapping<int, int> mapping(domain, codomain, f);
+    const std::vector<int>& values = mapping.codomain_elements();
+
+    size_t total = 0;
+    for (size_t j = 0; j < values.size(); ++j) {
+        Set<int> expected;
+        for (int x : domain) {
+            if (f(x) == values[j]) {
+                expected.insert(x);
+            }
+        }
+        CHECK(mapping.preimage(values[j]) == expected);
+
+        // Слой - индексы прообразов в области определения по возрастанию
+        const auto fibre = mapping.fibre(j);
+        CHECK(fibre.size() == expected.size());
+        for (size_t k = 0; k < fibre.size(); ++k) {
+            CHECK(expected.contains(mapping.domain_elements()[fibre[k]]));
+            CHECK(k == 0 || fibre[k - 1] < fibre[k]);
+        }
+        total += fibre.size();
+    }
+    CHECK(total == domain.size());
+
+    // Прообразы подмножеств: пустого, «чётных» значений, значения вне области значений
+    Set<int> even;
+    for (int y : codomain) {
+        if (y % 2 == 0) {
+            even.insert(y);
+        }
+    }
+    even.insert(1000);
+    Set<int> expected_even;
+    for (int x : domain) {
+        if (f(x) % 2 == 0) {
+            expected_even.insert(x);
+        }
+    }
+    CHECK(mapping.preimage(even) == expected_even);
+    CHECK(mapping.preimage(Set<int>{}).empty());
+    CHECK(mapping.preimage(1000).empty());
+}
+
+int main() {
+    const Set<int> z30 = test::range_set(30);
+    check_preimages(z30, z30, [](int x) { return x; });
+    check_preimages(z30, z30, [](int x) { return x * x % 30; });
+    check_preimages(z30, z30, [](int x) { return 6 * x % 30; });
+    check_preimages(z30, test::range_set(5), [](int x) { return x % 5; });
+    check_preimages(z30, Set<int>{7, 100}, [](int) { return 7; });
+    check_preimages(test::range_set(3), z30, [](int x) { return 10 * x; });
+
+    return test::finish();
+}
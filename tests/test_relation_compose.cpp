@@ -0,0 +1,104 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief R ∘ S по определению: (a, c), если (a, b) ∈ S и (b, c) ∈ R
+ */
+template<typename T>
+Set<std::pair<T, T>> naive_compose(const Relation<T>& r, const Relation<T>& s) {
+    Set<std::pair<T, T>> result;
+    for (const auto& [a, b] : s.get_pairs()) {
+        for (const auto& [b2, c] : r.get_pairs()) {
+            if (b == b2) {
+                result.insert({a, c});
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Случайная матрица rows × cols и её копия в виде vector<bool>
+ */
+std::pair<BitMatrix, std::vector<std::vector<bool>>> random_matrix(size_t rows, size_t cols,
+                                                                   test::Lcg& random) {
+    BitMatrix matrix(rows, cols);
+    std::vector<std::vector<bool>> naive(rows, std::vector<bool>(cols, false));
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            if (random.next() % 5 == 0) {
+                matrix.set(i, j);
+                naive[i][j] = true;
+            }
+        }
+    }
+    return {std::move(matrix), std::move(naive)};
+}
+
+bool matches_naive_product(const BitMatrix& product, const std::vector<std::vector<bool>>& a,
+                           const std::vector<std::vector<bool>>& b) {
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (size_t j = 0; j < product.cols(); ++j) {
+            bool expected = false;
+            for (size_t k = 0; k < b.size(); ++k) {
+                expected = expected || (a[i][k] && b[k][j]);
+            }
+            if (product.test(i, j) != expected) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    test::Lcg random{34};
+
+    // Произведение «четырёх русских»: размеры вокруг групп по 8 строк и слов по 64 бита
+    for (auto [rows, inner, cols] : {std::tuple{1, 1, 1}, std::tuple{7, 9, 8}, std::tuple{63, 64, 65},
+                                     std::tuple{130, 17, 70}, std::tuple{600, 72, 129}}) {
+        auto [a, naive_a] = random_matrix(static_cast<size_t>(rows), static_cast<size_t>(inner), random);
+        auto [b, naive_b] = random_matrix(static_cast<size_t>(inner), static_cast<size_t>(cols), random);
+        const BitMatrix product = a.multiply(b);
+        CHECK(matches_naive_product(product, naive_a, naive_b));
+        CHECK(a.multiply_parallel(b, 4) == product);
+        CHECK(a.multiply_parallel(b) == product);
+    }
+    CHECK_THROWS(BitMatrix(3, 4).multiply(BitMatrix(5, 3)), std::domain_error);
+
+    // Композиция и степени: плотные, разреженные и смешанные пары отношений
+    const Relation<int> dense = test::random_relation(40, 400, random);
+    const Relation<int> dense_other = test::random_relation(40, 300, random);
+    const Relation<int> sparse = test::random_relation(40, 15, random);
+    CHECK(!dense.is_sparse() && sparse.is_sparse());
+    for (const Relation<int>* r : {&dense, &sparse}) {
+        for (const Relation<int>* s : {&dense_other, &sparse}) {
+            const Set<std::pair<int, int>> expected = naive_compose(*r, *s);
+            CHECK(r->compose(*s).get_pairs() == expected);
+            CHECK(r->compose(*s, 4).get_pairs() == expected);
+        }
+
+        Set<std::pair<int, int>> diagonal;
+        for (int a = 0; a < 40; ++a) {
+            diagonal.insert({a, a});
+        }
+        Relation<int> expected(r->get_set(), diagonal);
+        for (size_t k = 0; k <= 6; ++k) {
+            CHECK(r->power(k) == expected);
+            expected = Relation<int>(r->get_set(), naive_compose(*r, expected));
+        }
+
+        const Set<std::pair<int, int>> closure = test::naive_closure(*r);
+        CHECK(r->reflexive_transitive_closure().get_pairs() == closure);
+        CHECK(r->reflexive_transitive_closure(0).get_pairs() == closure);
+    }
+    CHECK_THROWS(dense.compose(test::random_relation(10, 5, random)), std::domain_error);
+
+    return test::finish();
+}
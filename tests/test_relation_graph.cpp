@@ -0,0 +1,80 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Проверить свойства разреженного отношения перебором его пар
+ */
+void check_sparse_relation(const Relation<int>& relation) {
+    CHECK(relation.is_sparse());
+    const auto& pairs = relation.get_pairs();
+
+    bool reflexive = true;
+    for (int a : relation.get_set()) {
+        reflexive = reflexive && pairs.contains({a, a});
+    }
+    bool symmetric = true;
+    bool antisymmetric = true;
+    bool transitive = true;
+    for (const auto& [a, b] : pairs) {
+        symmetric = symmetric && pairs.contains({b, a});
+        antisymmetric = antisymmetric && (a == b || !pairs.contains({b, a}));
+        for (const auto& [c, d] : pairs) {
+            transitive = transitive && (c != b || pairs.contains({a, d}));
+        }
+    }
+
+    CHECK(relation.is_reflexive() == reflexive);
+    CHECK(relation.is_symmetric() == symmetric);
+    CHECK(relation.is_antisymmetric() == antisymmetric);
+    CHECK(relation.is_transitive() == transitive);
+
+    const Set<std::pair<int, int>> closure = test::naive_closure(relation);
+    CHECK(relation.transitive_closure().get_pairs() == closure);
+    CHECK(relation.reflexive_transitive_closure().get_pairs() == closure);
+
+    // Компоненты Тарьяна: u и v в одной компоненте ⇔ каждая достижима из другой;
+    // дуги между компонентами ведут к меньшим номерам
+    const RelationGraph& graph = relation.graph();
+    const StronglyConnectedComponents scc = graph.strongly_connected_components();
+    bool components_match = scc.component.size() == graph.vertex_count();
+    for (size_t u = 0; components_match && u < graph.vertex_count(); ++u) {
+        CHECK(scc.component[u] < scc.count);
+        for (size_t v = 0; v < graph.vertex_count(); ++v) {
+            const bool mutual = closure.contains({static_cast<int>(u), static_cast<int>(v)}) &&
+                                closure.contains({static_cast<int>(v), static_cast<int>(u)});
+            components_match = components_match && mutual == (scc.component[u] == scc.component[v]);
+        }
+        for (size_t v : graph.neighbors(u)) {
+            components_match = components_match && scc.component[v] <= scc.component[u];
+        }
+    }
+    CHECK(components_match);
+}
+
+int main() {
+    test::Lcg random{32};
+
+    // Случайные разреженные отношения: от леса до графа с крупными циклами
+    for (size_t pair_count : {0, 20, 100, 250, 380}) {
+        check_sparse_relation(test::random_relation(160, pair_count, random));
+    }
+
+    // Цепочка и цикл: одна компонента на вершину против одной на весь граф
+    Set<std::pair<int, int>> chain;
+    Set<std::pair<int, int>> cycle;
+    for (int i = 0; i < 99; ++i) {
+        chain.insert({i, i + 1});
+        cycle.insert({i, i + 1});
+    }
+    cycle.insert({99, 0});
+    check_sparse_relation(Relation<int>(test::range_set(100), chain));
+    check_sparse_relation(Relation<int>(test::range_set(100), cycle));
+    CHECK(Relation<int>(test::range_set(100), cycle).graph().strongly_connected_components().count == 1);
+
+    return test::finish();
+}
@@ -0,0 +1,105 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Свойства отношения перебором пар и троек элементов
+ */
+struct NaiveProperties {
+    bool reflexive = true;
+    bool symmetric = true;
+    bool antisymmetric = true;
+    bool transitive = true;
+};
+
+template<typename T>
+NaiveProperties naive_properties(const Relation<T>& relation) {
+    NaiveProperties result;
+    const Set<T>& set = relation.get_set();
+    for (const auto& a : set) {
+        result.reflexive = result.reflexive && relation.related(a, a);
+        for (const auto& b : set) {
+            if (!relation.related(a, b)) {
+                continue;
+            }
+            result.symmetric = result.symmetric && relation.related(b, a);
+            result.antisymmetric = result.antisymmetric && (a == b || !relation.related(b, a));
+            for (const auto& c : set) {
+                result.transitive = result.transitive && (!relation.related(b, c) || relation.related(a, c));
+            }
+        }
+    }
+    return result;
+}
+
+template<typename T>
+void check_relation(const Relation<T>& relation) {
+    const NaiveProperties expected = naive_properties(relation);
+    CHECK(relation.is_reflexive() == expected.reflexive);
+    CHECK(relation.is_symmetric() == expected.symmetric);
+    CHECK(relation.is_antisymmetric() == expected.antisymmetric);
+    CHECK(relation.is_transitive() == expected.transitive);
+    CHECK(relation.is_equivalence_relation() ==
+          (expected.reflexive && expected.symmetric && expected.transitive));
+    CHECK(relation.is_partial_order() ==
+          (expected.reflexive && expected.antisymmetric && expected.transitive));
+    CHECK(relation.transitive_closure().get_pairs() == test::naive_closure(relation));
+}
+
+int main() {
+    // Плотные отношения: размеры по обе стороны границы 64-битного слова строки
+    const Set<int> small = test::range_set(20);
+    const Set<int> wide = test::range_set(70);
+    for (const Set<int>* set : {&small, &wide}) {
+        check_relation(Relation<int>(*set, [](int a, int b) { return a <= b; }));
+        check_relation(Relation<int>(*set, [](int a, int b) { return a % 3 == b % 3; }));
+        check_relation(Relation<int>(*set, [](int a, int b) { return b % (a + 1) == 0; }));
+        check_relation(Relation<int>(*set, [](int a, int b) { return (a * 7 + b * 13) % 11 < 3; }));
+        check_relation(Relation<int>(*set, [](int a, int b) { return a == b + 1 || a == b + 2; }));
+        check_relation(Relation<int>(*set, [](int a, int b) { return a != b; }));
+        check_relation(Relation<int>(*set, [](int, int) { return true; }));
+    }
+
+    // Случайные отношения с плотностью выше порога разреженного представления
+    test::Lcg random{31};
+    for (size_t pair_count : {40, 150, 600}) {
+        const Relation<int> relation = test::random_relation(40, pair_count, random);
+        CHECK(!relation.is_sparse());
+        check_relation(relation);
+    }
+
+    // Замыкание Уоршелла на битовой матрице против тройного цикла над bool
+    for (size_t n : {1, 5, 63, 64, 65, 130}) {
+        BitMatrix matrix(n, n);
+        std::vector<std::vector<bool>> naive(n, std::vector<bool>(n, false));
+        for (size_t k = 0; k < 2 * n; ++k) {
+            const size_t i = random.next() % n;
+            const size_t j = random.next() % n;
+            matrix.set(i, j);
+            naive[i][j] = true;
+        }
+        matrix.transitive_closure_inplace();
+        for (size_t k = 0; k < n; ++k) {
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    if (naive[i][k] && naive[k][j]) {
+                        naive[i][j] = true;
+                    }
+                }
+            }
+        }
+        bool equal = true;
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                equal = equal && matrix.test(i, j) == naive[i][j];
+            }
+        }
+        CHECK(equal);
+    }
+
+    return test::finish();
+}
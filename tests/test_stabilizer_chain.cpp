@@ -0,0 +1,162 @@
+#include "test_common.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Все элементы группы, порождённой перестановками, обходом в ширину
+ */
+std::set<DynamicPermutation> naive_closure(size_t degree, const std::vector<DynamicPermutation>& generators) {
+    std::set<DynamicPermutation> elements{DynamicPermutation(degree)};
+    std::vector<DynamicPermutation> queue{DynamicPermutation(degree)};
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (const auto& g : generators) {
+            DynamicPermutation next = queue[head] * g;
+            if (elements.insert(next).second) {
+                queue.push_back(std::move(next));
+            }
+        }
+    }
+    return elements;
+}
+
+/**
+ * @brief Перестановка, заданная произведением непересекающихся циклов
+ */
+DynamicPermutation cycles(size_t degree, const std::vector<std::vector<size_t>>& list) {
+    std::vector<size_t> images(degree);
+    std::iota(images.begin(), images.end(), size_t{0});
+    for (const auto& cycle : list) {
+        for (size_t k = 0; k < cycle.size(); ++k) {
+            images[cycle[k]] = cycle[(k + 1) % cycle.size()];
+        }
+    }
+    return DynamicPermutation(images);
+}
+
+void check_chain(size_t degree, const std::vector<DynamicPermutation>& generators, std::mt19937& random) {
+    const StabilizerChain chain(degree, generators);
+    const std::set<DynamicPermutation> elements = naive_closure(degree, generators);
+
+    CHECK(chain.order() == elements.size());
+    CHECK(chain.order_string() == std::to_string(elements.size()));
+    size_t orbit_product = 1;
+    for (size_t size : chain.basic_orbit_sizes()) {
+        orbit_product *= size;
+    }
+    CHECK(orbit_product == elements.size());
+    for (const auto& s : chain.strong_generators()) {
+        CHECK(elements.contains(s));
+    }
+
+    // Принадлежность: все перестановки степени degree
+    std::vector<size_t> images(degree);
+    std::iota(images.begin(), images.end(), size_t{0});
+    bool membership_matches = true;
+    do {
+        const DynamicPermutation p(images);
+        membership_matches = membership_matches && chain.contains(p) == elements.contains(p);
+    } while (std::next_permutation(images.begin(), images.end()));
+    CHECK(membership_matches);
+
+    // Случайные элементы лежат в группе и при достаточной выборке покрывают её
+    std::map<DynamicPermutation, size_t> hits;
+    const size_t samples = 20 * elements.size();
+    for (size_t k = 0; k < samples; ++k) {
+        const DynamicPermutation x = chain.random_element(random);
+        CHECK(elements.contains(x));
+        ++hits[x];
+    }
+    CHECK(hits.size() == elements.size());
+}
+
+int main() {
+    std::mt19937 random(40);
+    const size_t n = 6;
+
+    check_chain(n, {}, random);
+    check_chain(n, {cycles(n, {{0, 1}}), cycles(n, {{0, 1, 2, 3, 4, 5}})}, random);          // S6
+    check_chain(n, {cycles(n, {{0, 1, 2}}), cycles(n, {{1, 2, 3, 4, 5}})}, random);          // A6
+    check_chain(n, {cycles(n, {{0, 1, 2, 3, 4, 5}}), cycles(n, {{1, 5}, {2, 4}})}, random);  // D6
+    check_chain(n, {cycles(n, {{0, 1, 2}, {3, 4, 5}}), cycles(n, {{0, 3}, {1, 4}, {2, 5}})}, random);
+    check_chain(n, {cycles(n, {{0, 1}, {2, 3, 4}})}, random);                                // Z6
+    check_chain(n, {cycles(n, {{0, 1, 2, 3, 4}}), cycles(n, {{1, 2, 4, 3}})}, random);      // AGL(1, 5)
+
+    // Подгруппы и индексы: A6 ≤ S6, D6 ≤ S6
+    const StabilizerChain s6(n, {cycles(n, {{0, 1}}), cycles(n, {{0, 1, 2, 3, 4, 5}})});
+    const StabilizerChain a6(n, {cycles(n, {{0, 1, 2}}), cycles(n, {{1, 2, 3, 4, 5}})});
+    const StabilizerChain d6(n, {cycles(n, {{0, 1, 2, 3, 4, 5}}), cycles(n, {{1, 5}, {2, 4}})});
+    CHECK(a6.is_subgroup_of(s6) && a6.index_in(s6) == 2);
+    CHECK(d6.is_subgroup_of(s6) && d6.index_in(s6) == 60);
+    CHECK(!s6.is_subgroup_of(a6) && !d6.is_subgroup_of(a6));
+    CHECK_THROWS(s6.index_in(a6), std::invalid_argument);
+
+    // Порождающие фиксированной степени дают ту же цепочку
+    const StabilizerChain s5(std::vector<Permutation<5>>{Permutation<5>::cycle({0, 1}),
+                                                         Permutation<5>::cycle({0, 1, 2, 3, 4})});
+    CHECK(s5.order() == 120);
+
+    // Большие группы: S20 и группа кубика Рубика (порядок не помещается в size_t)
+    std::vector<size_t> long_cycle(20);
+    std::iota(long_cycle.begin(), long_cycle.end(), size_t{0});
+    const StabilizerChain s20(20, {cycles(20, {{0, 1}}), cycles(20, {long_cycle})});
+    CHECK(s20.order() == 2432902008176640000ULL);
+
+    const auto face = [](std::vector<std::vector<size_t>> list) {
+        for (auto& cycle : list) {
+            for (auto& point : cycle) {
+                --point;
+            }
+        }
+        return cycles(48, list);
+    };
+    const StabilizerChain cube(48, {
+        face({{1, 3, 8, 6}, {2, 5, 7, 4}, {9, 33, 25, 17}, {10, 34, 26, 18}, {11, 35, 27, 19}}),
+        face({{9, 11, 16, 14}, {10, 13, 15, 12}, {1, 17, 41, 40}, {4, 20, 44, 37}, {6, 22, 46, 35}}),
+        face({{17, 19, 24, 22}, {18, 21, 23, 20}, {6, 25, 43, 16}, {7, 28, 42, 13}, {8, 30, 41, 11}}),
+        face({{25, 27, 32, 30}, {26, 29, 31, 28}, {3, 38, 43, 19}, {5, 36, 45, 21}, {8, 33, 48, 24}}),
+        face({{33, 35, 40, 38}, {34, 37, 39, 36}, {3, 9, 46, 32}, {2, 12, 47, 29}, {1, 14, 48, 27}}),
+        face({{41, 43, 48, 46}, {42, 45, 47, 44}, {14, 22, 30, 38}, {15, 23, 31, 39}, {16, 24, 32, 40}})});
+    CHECK(cube.order_string() == "43252003274489856000");
+    CHECK_THROWS(cube.order(), std::overflow_error);
+    for (size_t k = 0; k < 20; ++k) {
+        CHECK(cube.contains(cube.random_element(random)));
+    }
+    CHECK(!cube.contains(cycles(48, {{0, 1}})));
+
+    // Большая степень: длинные орбиты и цепочка не должны углублять построение
+    const size_t degree = 40;
+    std::vector<size_t> wide_cycle(degree);
+    std::iota(wide_cycle.begin(), wide_cycle.end(), size_t{0});
+    const StabilizerChain wide(degree, {cycles(degree, {{0, 1}}), cycles(degree, {wide_cycle})});
+    std::vector<unsigned> factorial{1}; // Десятичные цифры n! от младших к старшим
+    for (unsigned n = 2; n <= degree; ++n) {
+        unsigned carry = 0;
+        for (auto& digit : factorial) {
+            const unsigned value = digit * n + carry;
+            digit = value % 10;
+            carry = value / 10;
+        }
+        for (; carry > 0; carry /= 10) {
+            factorial.push_back(carry % 10);
+        }
+    }
+    std::string expected_order;
+    for (auto it = factorial.rbegin(); it != factorial.rend(); ++it) {
+        expected_order += static_cast<char>('0' + *it);
+    }
+    CHECK(wide.order_string() == expected_order);
+    CHECK(wide.contains(wide.random_element(random)));
+
+    CHECK_THROWS(StabilizerChain(5, {DynamicPermutation(4)}), std::invalid_argument);
+
+    return test::finish();
+}
@@ -0,0 +1,118 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace cryptomath;
+
+template<typename T, typename Op>
+void check_lattice(const Group<T, Op>& group, size_t expected_count) {
+    const SubgroupLattice<T, Op> lattice(group);
+    const Set<Set<T>> expected = test::naive_subgroups(group);
+    CHECK(expected.size() == expected_count);
+    CHECK(lattice.size() == expected_count);
+
+    std::vector<Set<T>> subsets;
+    for (size_t i = 0; i < lattice.size(); ++i) {
+        const Subgroup<T, Op> subgroup = lattice.subgroup(i);
+        subsets.push_back(subgroup.get_subset());
+        CHECK(expected.contains(subsets.back()));
+        CHECK(lattice.order(i) == subsets.back().size());
+        CHECK(lattice.find(subgroup) == i);
+
+        std::vector<T> values;
+        for (size_t k : lattice.element_indices(i)) {
+            values.push_back(group.element_at(k));
+        }
+        CHECK(Set<T>(values.begin(), values.end()) == subsets.back());
+
+        Set<T> generators;
+        for (size_t k : lattice.generator_indices(i)) {
+            generators.insert(group.element_at(k));
+        }
+        CHECK(test::generated_set(group, generators) == subsets.back());
+    }
+    CHECK(Set<Set<T>>(subsets.begin(), subsets.end()) == expected);
+
+    // Нумерация по возрастанию порядка: {e} первая, G последняя
+    for (size_t i = 1; i < subsets.size(); ++i) {
+        CHECK(subsets[i - 1].size() <= subsets[i].size());
+    }
+    CHECK(subsets.front().size() == 1);
+    CHECK(subsets.back() == group.get_set());
+
+    for (size_t d = 1; d <= group.get_set().size(); ++d) {
+        size_t count = 0;
+        for (const auto& subset : subsets) {
+            count += subset.size() == d ? 1 : 0;
+        }
+        CHECK(lattice.subgroups_of_order(d).size() == count);
+        for (size_t i : lattice.subgroups_of_order(d)) {
+            CHECK(subsets[i].size() == d);
+        }
+    }
+
+    const size_t n = subsets.size();
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            const bool contained = subsets[i].is_subset_of(subsets[j]);
+            CHECK(lattice.is_contained(i, j) == contained);
+            CHECK(lattice.containment().test(i, j) == contained);
+            CHECK(subsets[lattice.meet(i, j)] == subsets[i].intersection(subsets[j]));
+            CHECK(subsets[lattice.join(i, j)] == test::generated_set(group, subsets[i] + subsets[j]));
+        }
+
+        // Максимальные подгруппы по определению: нет промежуточной подгруппы
+        std::vector<size_t> maximal;
+        for (size_t k = 0; k < n; ++k) {
+            if (k == i || !subsets[k].is_subset_of(subsets[i])) {
+                continue;
+            }
+            bool covered = true;
+            for (size_t m = 0; m < n && covered; ++m) {
+                covered = m == i || m == k || !subsets[k].is_subset_of(subsets[m]) ||
+                          !subsets[m].is_subset_of(subsets[i]);
+            }
+            if (covered) {
+                maximal.push_back(k);
+            }
+        }
+        CHECK(lattice.maximal_subgroups(i) == maximal);
+    }
+
+    CHECK_THROWS(lattice.order(n), std::out_of_range);
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_lattice(test::cyclic_group(1), 1);
+    check_lattice(test::cyclic_group(12), 6);
+    check_lattice(test::units_group(15), 8);
+    check_lattice(symmetric_group<3>(), 6);
+    check_lattice(symmetric_group<4>(), 30);
+    check_lattice(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})}), 10); // D4
+    check_lattice(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}), 10);     // A4
+    check_lattice(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})}), 16); // D6
+    // Z2³ не порождается двумя элементами
+    check_lattice(test::permutation_group<6>({P6::cycle({0, 1}), P6::cycle({2, 3}), P6::cycle({4, 5})}), 16);
+
+    // S5: число подгрупп и максимальные подгруппы самой группы
+    const auto s5 = symmetric_group<5>();
+    const SubgroupLattice<Permutation<5>, PermutationComposition> lattice(s5);
+    CHECK(lattice.size() == 156);
+    size_t maximal_orders = 0;
+    for (size_t i : lattice.maximal_subgroups(lattice.size() - 1)) {
+        maximal_orders += lattice.order(i);
+    }
+    // A5, 6 подгрупп порядка 20, 10 × (S3 × S2) порядка 12, 5 × S4
+    CHECK(maximal_orders == 60 + 6 * 20 + 10 * 12 + 5 * 24);
+
+    const auto other = symmetric_group<5>();
+    CHECK_THROWS(lattice.find(Subgroup<Permutation<5>, PermutationComposition>(other, other.get_set())),
+                 std::domain_error);
+
+    return test::finish();
+}
@@ -0,0 +1,68 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace cryptomath;
+
+/**
+ * @brief Произведение по определению: h1 ∘ h2 для всех пар, |H1| · |H2| операций
+ */
+template<typename T, typename Op>
+Set<T> naive_product(const Group<T, Op>& group, const Set<T>& a, const Set<T>& b) {
+    Set<T> result;
+    for (const auto& x : a) {
+        for (const auto& y : b) {
+            result.insert(group.operate_unchecked(x, y));
+        }
+    }
+    return result;
+}
+
+template<typename T, typename Op>
+void check_products(const Group<T, Op>& group) {
+    using SubgroupType = Subgroup<T, Op>;
+    std::vector<SubgroupType> subgroups;
+    for (const auto& subset : test::naive_subgroups(group)) {
+        subgroups.emplace_back(group, subset);
+    }
+
+    for (const auto& a : subgroups) {
+        for (const auto& b : subgroups) {
+            const Set<T> product = naive_product(group, a.get_subset(), b.get_subset());
+            const bool is_subgroup = test::generated_set(group, product) == product;
+            CHECK(SubgroupType::intersection(a, b).get_subset() == a.get_subset().intersection(b.get_subset()));
+            CHECK(SubgroupType::product(a, b) == product);
+            CHECK(SubgroupType::product_size(a, b) == product.size());
+            CHECK(SubgroupType::is_product_subgroup(a, b) == is_subgroup);
+            // H1 ∘ H2 - подгруппа тогда и только тогда, когда H1 ∘ H2 = H2 ∘ H1
+            CHECK(is_subgroup == (product == naive_product(group, b.get_subset(), a.get_subset())));
+        }
+    }
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_products(test::cyclic_group(12));
+    check_products(symmetric_group<3>());
+    check_products(symmetric_group<4>());
+    check_products(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})})); // D4
+    check_products(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}));     // A4
+    check_products(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})})); // D6
+
+    // Подгруппы разных групп
+    using S3 = Subgroup<Permutation<3>, PermutationComposition>;
+    const auto s3 = symmetric_group<3>();
+    const auto other = symmetric_group<3>();
+    const S3 whole(s3, s3.get_set());
+    const S3 foreign(other, other.get_set());
+    CHECK_THROWS(S3::intersection(whole, foreign), std::domain_error);
+    CHECK_THROWS(S3::product(whole, foreign), std::domain_error);
+    CHECK_THROWS(S3::product_size(whole, foreign), std::domain_error);
+    CHECK_THROWS(S3::is_product_subgroup(whole, foreign), std::domain_error);
+
+    return test::finish();
+}
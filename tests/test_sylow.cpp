@@ -0,0 +1,105 @@
+#include "test_common.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using namespace cryptomath;
+
+template<typename T, typename Op>
+Set<T> subset_of(const Group<T, Op>& group, const std::vector<size_t>& indices) {
+    std::vector<T> values;
+    for (size_t i : indices) {
+        values.push_back(group.element_at(i));
+    }
+    return Set<T>(values.begin(), values.end());
+}
+
+template<typename T, typename Op>
+void check_sylow(const Group<T, Op>& group) {
+    const Set<Set<T>> subgroups = test::naive_subgroups(group);
+    const size_t n = group.get_set().size();
+
+    for (size_t p : {2, 3, 5, 7}) {
+        size_t order = 1;
+        while (n % (order * p) == 0) {
+            order *= p;
+        }
+        // Силовские подгруппы по определению: все подгруппы порядка p^a
+        Set<Set<T>> expected;
+        for (const auto& subset : subgroups) {
+            if (subset.size() == order) {
+                expected.insert(subset);
+            }
+        }
+
+        const SylowSubgroup<T, Op> sylow(group, p);
+        CHECK(sylow.prime() == p);
+        CHECK(sylow.order() == order);
+        const Set<T> subset = sylow.subgroup().get_subset();
+        CHECK(expected.contains(subset));
+        CHECK(subset_of(group, sylow.element_indices()) == subset);
+        CHECK(test::generated_set(group, subset_of(group, sylow.generator_indices())) == subset);
+        CHECK((size_t{1} << sylow.generator_indices().size()) <= order);
+
+        CHECK(sylow.count() == expected.size());
+        CHECK(sylow.is_normal() == (expected.size() == 1));
+        CHECK(sylow.verify_sylow_theorems());
+        Set<Set<T>> conjugates;
+        for (const auto& conjugate : sylow.conjugates()) {
+            conjugates.insert(conjugate.get_subset());
+        }
+        CHECK(conjugates == expected);
+
+        Set<T> normalizer;
+        for (const auto& g : group.get_set()) {
+            Set<T> conjugate;
+            for (const auto& x : subset) {
+                conjugate.insert(group.operate_unchecked(group.operate_unchecked(g, x), group.inverse(g)));
+            }
+            if (conjugate == subset) {
+                normalizer.insert(g);
+            }
+        }
+        CHECK(sylow.normalizer().get_subset() == normalizer);
+        CHECK(subset_of(group, sylow.normalizer_indices()) == normalizer);
+    }
+}
+
+int main() {
+    using P4 = Permutation<4>;
+    using P6 = Permutation<6>;
+
+    check_sylow(test::cyclic_group(1));
+    check_sylow(test::cyclic_group(12));
+    check_sylow(test::units_group(21));
+    check_sylow(symmetric_group<3>());
+    check_sylow(symmetric_group<4>());
+    check_sylow(test::permutation_group<4>({P4::cycle({0, 1, 2, 3}), P4::cycle({1, 3})})); // D4
+    check_sylow(test::permutation_group<4>({P4::cycle({0, 1, 2}), P4({1, 0, 3, 2})}));     // A4
+    check_sylow(test::permutation_group<6>({P6::cycle({0, 1, 2, 3, 4, 5}), P6({0, 5, 4, 3, 2, 1})})); // D6
+    // Z7 ⋊ Z3: единственная силовская 7-подгруппа и семь силовских 3-подгрупп
+    check_sylow(test::permutation_group<7>({Permutation<7>::cycle({0, 1, 2, 3, 4, 5, 6}),
+                                            Permutation<7>::cycle({1, 2, 4}) * Permutation<7>::cycle({3, 6, 5})}));
+
+    // S5: n₂ = 15, n₃ = 10, n₅ = 6
+    const auto s5 = symmetric_group<5>();
+    const size_t expected[][3] = {{2, 8, 15}, {3, 3, 10}, {5, 5, 6}};
+    for (const auto& [p, order, count] : expected) {
+        const SylowSubgroup<Permutation<5>, PermutationComposition> sylow(s5, p);
+        CHECK(sylow.order() == order);
+        CHECK(sylow.count() == count);
+        CHECK(sylow.conjugates().size() == count);
+        CHECK(sylow.normalizer().size() * count == 120);
+        CHECK(sylow.verify_sylow_theorems());
+    }
+
+    CHECK((!SylowSubgroup<int, test::AddMod>::is_prime(1)));
+    CHECK((SylowSubgroup<int, test::AddMod>::is_prime(2)));
+    CHECK((!SylowSubgroup<int, test::AddMod>::is_prime(91)));
+    const auto z12 = test::cyclic_group(12);
+    CHECK_THROWS((SylowSubgroup<int, test::AddMod>(z12, 1)), std::invalid_argument);
+    CHECK_THROWS((SylowSubgroup<int, test::AddMod>(z12, 4)), std::invalid_argument);
+
+    return test::finish();
+}